@@ -0,0 +1,749 @@
+// CasseBriques_bench: micro-benchmarks for the collision and physics primitives of
+// the simulation core, plus full per-frame brick loops at growing brick/projectile counts.
+//
+// Output is one row per (benchmark, bricks, projectiles) in CSV (default) or JSON,
+// meant to be archived per build and diffed / plotted across builds.
+//
+//   CasseBriques_bench [--format csv|json] [--out FILE] [--filter TEXT]
+//                      [--min-time SECONDS] [--quick]
+//   CasseBriques_bench --check   (fixed-input correctness checks only; exit code 1 on failure)
+
+#include "bots/RebornAutoplayer.hpp"
+#include "core/AABB.hpp"
+#include "core/BrickField.hpp"
+#include "core/Collision.hpp"
+#include "core/CollisionBatch.hpp"
+#include "core/GameObject.hpp"
+#include "core/JobSystem.hpp"
+#include "core/SpatialGrid.hpp"
+#include "core/Trace.hpp"
+#include "game/Ball.hpp"
+#include "game/ClassicSimulation.hpp"
+#include "game_reborn/RebornSimulation.hpp"
+#include "level/Level.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Results are folded into this so the optimizer cannot drop the measured work
+    volatile std::uint64_t sink = 0;
+
+    struct Options
+    {
+        std::string format = "csv";
+        std::string outPath;
+        std::string filter;
+        double minTime = 0.2; // seconds per measurement
+        bool quick = false;
+        bool check = false;
+    };
+
+    struct Result
+    {
+        std::string name;
+        long bricks = 0;
+        long projectiles = 0;
+        long long iterations = 0; // calls of the measured body
+        double nsPerOp = 0.0;     // per call of the body
+        double itemsPerOp = 1.0;  // primitive operations inside one call
+    };
+
+    /**
+     * Runs body() until minTime is spent (doubling the batch size), returns ns per call.
+     * body returns a value folded into the sink.
+     */
+    double measure(const std::function<std::uint64_t()> &body, double minTime, long long &iterations)
+    {
+        std::uint64_t acc = body(); // warm-up (caches, first-touch allocations)
+
+        long long batch = 1;
+        for (;;)
+        {
+            const auto t0 = Clock::now();
+            for (long long i = 0; i < batch; i++)
+                acc += body();
+            const double seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+
+            if (seconds >= minTime || batch >= (1LL << 40))
+            {
+                sink = sink + acc;
+                iterations = batch;
+                return seconds * 1e9 / static_cast<double>(batch);
+            }
+
+            // Aim directly for minTime once the batch is measurable
+            const double scale = (seconds > 1e-4) ? std::min(10.0, 1.2 * minTime / seconds) : 10.0;
+            batch = std::max(batch + 1, static_cast<long long>(static_cast<double>(batch) * scale));
+        }
+    }
+
+    class Runner
+    {
+    public:
+        explicit Runner(const Options &opt) : opt(opt) {}
+
+        void run(const std::string &name, long bricks, long projectiles, double itemsPerOp,
+                 const std::function<std::uint64_t()> &body)
+        {
+            if (!opt.filter.empty() && name.find(opt.filter) == std::string::npos)
+                return;
+
+            Result r;
+            r.name = name;
+            r.bricks = bricks;
+            r.projectiles = projectiles;
+            r.itemsPerOp = itemsPerOp;
+            r.nsPerOp = measure(body, opt.minTime, r.iterations);
+            results.push_back(r);
+
+            std::cerr << std::left << std::setw(28) << name << " bricks=" << std::setw(7) << bricks
+                      << " proj=" << std::setw(5) << projectiles << std::right << std::fixed << std::setprecision(3)
+                      << std::setw(14) << r.nsPerOp << " ns/op" << std::setw(12) << r.nsPerOp / itemsPerOp << " ns/item\n";
+        }
+
+        const std::vector<Result> &getResults() const { return results; }
+
+    private:
+        const Options &opt;
+        std::vector<Result> results;
+    };
+
+    // --- Data sets ---
+
+    constexpr int SAMPLE_COUNT = 4096; // inputs per micro-benchmark call
+
+    struct Scene
+    {
+        BrickField bricks;
+        SpatialGrid grid;
+        float fieldW = 0.0f;
+        float fieldH = 0.0f;
+
+        std::vector<Vec2> projectilePos;
+        std::vector<Vec2> projectileVel;
+    };
+
+    // Brick grid with the game's brick geometry (72x28, 6 px spacing), as square as possible
+    void buildScene(Scene &s, long brickCount, long projectileCount, std::mt19937 &rng)
+    {
+        const float brickW = 72.0f;
+        const float brickH = 28.0f;
+        const float spacing = 6.0f;
+
+        const int cols = std::max(10, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(brickCount) * 0.5))));
+        const int rows = static_cast<int>((brickCount + cols - 1) / cols);
+        s.fieldW = cols * (brickW + spacing) + spacing;
+        s.fieldH = rows * (brickH + spacing) * 2.0f + 200.0f; // empty half below the bricks
+
+        s.bricks.clear();
+        s.bricks.reserve(static_cast<std::size_t>(brickCount));
+        for (long i = 0; i < brickCount; i++)
+        {
+            const int r = static_cast<int>(i / cols);
+            const int c = static_cast<int>(i % cols);
+            s.bricks.add(spacing + c * (brickW + spacing), 80.0f + r * (brickH + spacing), brickW, brickH, 1 + r % 4, Color::Green);
+        }
+        s.grid.rebuild(s.bricks.boxes());
+
+        std::uniform_real_distribution<float> ux(0.0f, s.fieldW);
+        std::uniform_real_distribution<float> uy(0.0f, s.fieldH);
+        std::uniform_real_distribution<float> ua(0.0f, 6.2831853f);
+        s.projectilePos.clear();
+        s.projectileVel.clear();
+        for (long i = 0; i < projectileCount; i++)
+        {
+            const float a = ua(rng);
+            s.projectilePos.emplace_back(ux(rng), uy(rng));
+            s.projectileVel.emplace_back(500.0f * std::cos(a), 500.0f * std::sin(a));
+        }
+    }
+
+    // --- Benchmarks ---
+
+    void benchPrimitives(Runner &runner, std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> pos(0.0f, 800.0f);
+        std::uniform_real_distribution<float> ext(4.0f, 80.0f);
+
+        std::vector<AABB> boxesA(SAMPLE_COUNT);
+        std::vector<AABB> boxesB(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; i++)
+        {
+            const float ax = pos(rng), ay = pos(rng), bx = pos(rng), by = pos(rng);
+            boxesA[i] = AABB{ax, ay, ax + ext(rng), ay + ext(rng)};
+            boxesB[i] = AABB{bx, by, bx + ext(rng) * 4.0f, by + ext(rng) * 4.0f};
+        }
+
+        runner.run("aabb_intersects", 0, 0, SAMPLE_COUNT, [&]()
+                   {
+                       std::uint64_t hits = 0;
+                       for (int i = 0; i < SAMPLE_COUNT; i++)
+                           hits += boxesA[i].intersects(boxesB[i]) ? 1 : 0;
+                       return hits; });
+
+        std::vector<GameObject> circles;
+        std::vector<GameObject> rects;
+        std::vector<GameObject> others;
+        circles.reserve(SAMPLE_COUNT);
+        rects.reserve(SAMPLE_COUNT);
+        others.reserve(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; i++)
+        {
+            circles.emplace_back(pos(rng), pos(rng), ext(rng) * 0.5f);
+            rects.emplace_back(pos(rng), pos(rng), ext(rng) * 4.0f, ext(rng) * 4.0f);
+            others.emplace_back(pos(rng), pos(rng), ext(rng) * 2.0f);
+        }
+
+        runner.run("checkCollision_circle_rect", 0, 0, SAMPLE_COUNT, [&]()
+                   {
+                       std::uint64_t hits = 0;
+                       for (int i = 0; i < SAMPLE_COUNT; i++)
+                           hits += circles[i].checkCollision(rects[i]) ? 1 : 0;
+                       return hits; });
+
+        runner.run("checkCollision_circle_circle", 0, 0, SAMPLE_COUNT, [&]()
+                   {
+                       std::uint64_t hits = 0;
+                       for (int i = 0; i < SAMPLE_COUNT; i++)
+                           hits += circles[i].checkCollision(others[i]) ? 1 : 0;
+                       return hits; });
+
+        runner.run("circleRectCollisionNormal", 0, 0, SAMPLE_COUNT, [&]()
+                   {
+                       std::uint64_t hits = 0;
+                       Vec2 n;
+                       float pen = 0.0f;
+                       for (int i = 0; i < SAMPLE_COUNT; i++)
+                       {
+                           if (Collision::circleRectCollisionNormal(circles[i].getPosition(), circles[i].getRadius(), boxesB[i], n, pen))
+                               hits += static_cast<std::uint64_t>(pen);
+                       }
+                       return hits; });
+
+        runner.run("sweepCircleAABB", 0, 0, SAMPLE_COUNT, [&]()
+                   {
+                       std::uint64_t hits = 0;
+                       Vec2 n;
+                       float t = 0.0f;
+                       for (int i = 0; i < SAMPLE_COUNT; i++)
+                       {
+                           const Vec2 motion(boxesA[i].right - boxesA[i].left, boxesA[i].bottom - boxesA[i].top);
+                           if (Collision::sweepCircleAABB(circles[i].getPosition(), motion * 4.0f, circles[i].getRadius(), boxesB[i], t, n))
+                               hits++;
+                       }
+                       return hits; });
+
+        std::vector<Ball> balls;
+        std::vector<float> paddleX(SAMPLE_COUNT);
+        balls.reserve(SAMPLE_COUNT);
+        for (int i = 0; i < SAMPLE_COUNT; i++)
+        {
+            balls.emplace_back(pos(rng), 540.0f, 8.0f, 800.0f, 600.0f, 320.0f);
+            balls.back().setVelocity(120.0f, 300.0f);
+            paddleX[i] = pos(rng) - 60.0f;
+        }
+
+        runner.run("Ball_bounceOnPaddle", 0, 0, SAMPLE_COUNT, [&]()
+                   {
+                       float vx = 0.0f;
+                       for (int i = 0; i < SAMPLE_COUNT; i++)
+                       {
+                           balls[i].bounceOnPaddle(paddleX[i], 120.0f);
+                           vx += balls[i].getVelocity().x;
+                       }
+                       return static_cast<std::uint64_t>(std::fabs(vx)); });
+    }
+
+    void benchBatchKernel(Runner &runner, const std::vector<long> &counts, std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> pos(0.0f, 800.0f);
+        std::uniform_real_distribution<float> ext(20.0f, 80.0f);
+
+        for (const long n : counts)
+        {
+            Collision::CircleRectBatch batch;
+            for (long i = 0; i < n; i++)
+                batch.add(pos(rng), pos(rng), ext(rng), ext(rng) * 0.4f);
+
+            // Every kernel this CPU can run (circleRectBatch uses the last one)
+            std::vector<std::uint8_t> hit(static_cast<std::size_t>(n));
+            std::vector<float> nx(hit.size()), ny(hit.size()), pen(hit.size());
+            for (const Collision::BatchKernel &kernel : Collision::batchKernels())
+            {
+                runner.run(std::string("circleRectBatch_") + kernel.name, n, 1, static_cast<double>(n), [&]()
+                           {
+                               return static_cast<std::uint64_t>(kernel.run(
+                                   400.0f, 300.0f, 8.0f, batch.x.data(), batch.y.data(), batch.w.data(), batch.h.data(),
+                                   hit.size(), hit.data(), nx.data(), ny.data(), pen.data())); });
+            }
+        }
+    }
+
+    void benchFrameLoops(Runner &runner, const std::vector<long> &brickCounts, const std::vector<long> &projectileCounts,
+                         std::mt19937 &rng)
+    {
+        const float dt = 1.0f / 120.0f;
+        const float radius = 8.0f;
+
+        for (const long n : brickCounts)
+        {
+            Scene scene;
+            buildScene(scene, n, 0, rng);
+
+            // Per-step loops over the whole field (Reborn descent, danger line, win check)
+            runner.run("frame_field_update", n, 0, static_cast<double>(n), [&]()
+                       {
+                           scene.bricks.translateY(0.001f);
+                           const float lowest = scene.bricks.lowestAliveBottom();
+                           return static_cast<std::uint64_t>(lowest) + (scene.bricks.allDestroyed() ? 1 : 0); });
+
+            for (const long p : projectileCounts)
+            {
+                buildScene(scene, n, p, rng);
+
+                // Baseline: every projectile against every live brick (the pre-broadphase loop)
+                GameObject probe(0.0f, 0.0f, radius);
+                runner.run("frame_bruteforce", n, p, static_cast<double>(n) * static_cast<double>(p), [&]()
+                           {
+                               std::uint64_t hits = 0;
+                               for (long k = 0; k < p; k++)
+                               {
+                                   probe.setPosition(scene.projectilePos[k]);
+                                   for (std::size_t i = 0; i < scene.bricks.size(); i++)
+                                   {
+                                       if (scene.bricks.alive[i] && probe.checkCollision(scene.bricks.getAABB(i)))
+                                           hits++;
+                                   }
+                               }
+                               return hits; });
+
+                // What the simulations do: swept broadphase query, SIMD narrowphase, TOI sweep
+                Collision::CircleRectBatch narrowphase;
+                std::vector<int> candidates;
+                runner.run("frame_grid_narrowphase", n, p, static_cast<double>(p), [&]()
+                           {
+                               std::uint64_t hits = 0;
+                               for (long k = 0; k < p; k++)
+                               {
+                                   const Vec2 start = scene.projectilePos[k];
+                                   const Vec2 motion = scene.projectileVel[k] * dt;
+                                   const AABB from{start.x - radius, start.y - radius, start.x + radius, start.y + radius};
+                                   const AABB to{from.left + motion.x, from.top + motion.y, from.right + motion.x, from.bottom + motion.y};
+
+                                   scene.grid.query(SpatialGrid::sweep(from, to), candidates);
+                                   narrowphase.clear();
+                                   for (const int i : candidates)
+                                   {
+                                       if (scene.bricks.alive[i])
+                                           narrowphase.add(scene.bricks.x[i], scene.bricks.y[i], scene.bricks.w[i], scene.bricks.h[i]);
+                                   }
+                                   hits += static_cast<std::uint64_t>(narrowphase.run(start, radius));
+
+                                   float t = 0.0f;
+                                   Vec2 normal;
+                                   for (std::size_t j = 0; j < narrowphase.size(); j++)
+                                   {
+                                       if (!narrowphase.hit[j] &&
+                                           Collision::sweepCircleAABB(start, motion, radius,
+                                                                      AABB{narrowphase.x[j], narrowphase.y[j], narrowphase.x[j] + narrowphase.w[j], narrowphase.y[j] + narrowphase.h[j]},
+                                                                      t, normal))
+                                           hits++;
+                                   }
+                               }
+                               return hits; });
+            }
+        }
+    }
+
+    void benchSimulations(Runner &runner)
+    {
+        // Full fixed steps of the real rules (60-brick levels), restarted when a game ends
+        ClassicSimulation classic(Difficulty::Normal);
+        ClassicInput classicInput;
+        classicInput.launch = true;
+        float paddleDir = 1.0f;
+        runner.run("classic_step", ClassicSimulation::BRICK_ROWS * ClassicSimulation::BRICK_COLS, 1, 1.0, [&]()
+                   {
+                       // Paddle follows the ball so games last
+                       const float bx = classic.getBall().getPosition().x;
+                       const float px = classic.getPaddle().getPosition().x + classic.getPaddle().getSize().x / 2.0f;
+                       paddleDir = (bx < px) ? -1.0f : 1.0f;
+                       classicInput.moveLeft = paddleDir < 0.0f;
+                       classicInput.moveRight = paddleDir > 0.0f;
+                       classic.step(1.0f / 120.0f, classicInput);
+                       if (classic.getState() != ClassicSimulation::State::Playing)
+                           classic.resetAll();
+                       return static_cast<std::uint64_t>(classic.getScore()); });
+
+        RebornSimulation reborn(Difficulty::Normal);
+        RebornInput rebornInput;
+        rebornInput.fireHeld = true;
+        long tick = 0;
+        runner.run("reborn_step", RebornSimulation::BRICK_ROWS * RebornSimulation::BRICK_COLS,
+                   reborn.getMaxActive(), 1.0, [&]()
+                   {
+                       // Sweep the aim across the field
+                       const float a = static_cast<float>(tick++ % 240) / 240.0f;
+                       rebornInput.aim = Vec2(100.0f + 600.0f * a, 100.0f);
+                       reborn.step(1.0f / 120.0f, rebornInput);
+                       if (reborn.getState() != RebornSimulation::State::Playing)
+                           reborn.resetAll();
+                       return static_cast<std::uint64_t>(reborn.getScore()); });
+
+        // Endless mode: same step plus row streaming into recycled slots (cost must stay flat)
+        RebornSimulation endless(Difficulty::Normal, LevelGrid(), RebornSimulation::Mode::Endless, 1);
+        tick = 0;
+        runner.run("reborn_endless_step", static_cast<long>(endless.getBricks().size()), endless.getMaxActive(), 1.0, [&]()
+                   {
+                       const float a = static_cast<float>(tick++ % 240) / 240.0f;
+                       rebornInput.aim = Vec2(100.0f + 600.0f * a, 100.0f);
+                       endless.step(1.0f / 120.0f, rebornInput);
+                       if (endless.getState() != RebornSimulation::State::Playing)
+                           endless.resetAll();
+                       return static_cast<std::uint64_t>(endless.getStreamedRows()); });
+
+        // One full look-ahead search of the Reborn autoplayer (must fit in a 60 Hz frame)
+        for (const unsigned threads : {1u, 4u})
+        {
+            JobSystem jobs(threads);
+            RebornAutoplayer::Config config;
+            config.decisionSeconds = 0.0f; // search on every call
+            RebornAutoplayer bot(jobs, config);
+            RebornSimulation game(Difficulty::Normal);
+            runner.run("reborn_autoplay_search_t" + std::to_string(threads),
+                       RebornSimulation::BRICK_ROWS * RebornSimulation::BRICK_COLS, game.getMaxActive(), 1.0, [&]()
+                       {
+                           game.step(1.0f / 120.0f, bot.think(game, 1.0f / 120.0f));
+                           if (game.getState() != RebornSimulation::State::Playing)
+                               game.resetAll();
+                           return static_cast<std::uint64_t>(game.getUsed()); });
+        }
+    }
+
+    // Level loading: text parse vs. opening the compiled pack, then building the bricks
+    void benchLevels(Runner &runner, const std::vector<long> &brickCounts, std::mt19937 &rng)
+    {
+        std::uniform_int_distribution<int> hp(0, 4);
+        const std::string packPath = (std::filesystem::temp_directory_path() / "cassebriques_bench.cblp").string();
+
+        for (const long n : brickCounts)
+        {
+            const int cols = std::max(10, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(n)))));
+            const int rows = static_cast<int>((n + cols - 1) / cols);
+
+            Level level;
+            level.rows = rows;
+            level.cols = cols;
+            level.hp.resize(static_cast<std::size_t>(rows) * cols);
+            std::ostringstream text;
+            text << rows << ' ' << cols << '\n';
+            for (std::size_t i = 0; i < level.hp.size(); i++)
+            {
+                level.hp[i] = static_cast<std::uint8_t>(hp(rng));
+                text << static_cast<int>(level.hp[i]) << ((i + 1) % cols == 0 ? '\n' : ' ');
+            }
+            const std::string source = text.str();
+
+            std::string error;
+            if (!LevelPack::write(packPath, {level.grid()}, error))
+            {
+                std::cerr << "benchLevels: " << error << "\n";
+                return;
+            }
+
+            const long cells = static_cast<long>(level.hp.size());
+            runner.run("level_text_parse", cells, 0, static_cast<double>(cells), [&]()
+                       {
+                           Level parsed;
+                           Level::parseText(source, parsed, error);
+                           return static_cast<std::uint64_t>(parsed.hp.size()); });
+
+            runner.run("level_pack_open", cells, 0, static_cast<double>(cells), [&]()
+                       {
+                           LevelPack pack;
+                           pack.open(packPath, error);
+                           return static_cast<std::uint64_t>(pack.level(0).rows); });
+
+            LevelPack pack;
+            pack.open(packPath, error);
+            runner.run("level_pack_to_bricks", cells, 0, static_cast<double>(cells), [&]()
+                       {
+                           RebornSimulation sim(Difficulty::Normal, pack.level(0));
+                           return static_cast<std::uint64_t>(sim.getBricks().size()); });
+        }
+
+        std::error_code ec;
+        std::filesystem::remove(packPath, ec);
+    }
+
+    std::string jsonEscape(const std::string &s)
+    {
+        std::string out;
+        for (const char c : s)
+        {
+            if (c == '"' || c == '\\')
+                out += '\\';
+            out += c;
+        }
+        return out;
+    }
+
+    std::string compilerName()
+    {
+        std::ostringstream ss;
+#if defined(__clang__)
+        ss << "clang " << __clang_major__ << "." << __clang_minor__;
+#elif defined(__GNUC__)
+        ss << "gcc " << __GNUC__ << "." << __GNUC_MINOR__;
+#elif defined(_MSC_VER)
+        ss << "msvc " << _MSC_VER;
+#else
+        ss << "unknown";
+#endif
+        return ss.str();
+    }
+
+    void writeCsv(std::ostream &os, const std::vector<Result> &results)
+    {
+        os << "benchmark,bricks,projectiles,iterations,ns_per_op,items_per_op,ns_per_item\n";
+        os << std::setprecision(6) << std::fixed;
+        for (const Result &r : results)
+        {
+            os << r.name << ',' << r.bricks << ',' << r.projectiles << ',' << r.iterations << ','
+               << r.nsPerOp << ',' << r.itemsPerOp << ',' << r.nsPerOp / r.itemsPerOp << '\n';
+        }
+    }
+
+    void writeJson(std::ostream &os, const std::vector<Result> &results, const Options &opt)
+    {
+        os << std::setprecision(6) << std::fixed;
+        os << "{\n  \"context\": {\"compiler\": \"" << jsonEscape(compilerName()) << "\""
+#ifdef NDEBUG
+           << ", \"build\": \"release\""
+#else
+           << ", \"build\": \"debug\""
+#endif
+           << ", \"simd\": \"" << Collision::batchKernelName() << "\""
+           << ", \"simd_width\": " << Collision::batchWidth()
+           << ", \"tracing\": " << (Trace::isEnabled() ? "true" : "false")
+           << ", \"min_time_s\": " << opt.minTime << "},\n";
+        os << "  \"benchmarks\": [\n";
+        for (std::size_t i = 0; i < results.size(); i++)
+        {
+            const Result &r = results[i];
+            os << "    {\"name\": \"" << jsonEscape(r.name) << "\", \"bricks\": " << r.bricks
+               << ", \"projectiles\": " << r.projectiles << ", \"iterations\": " << r.iterations
+               << ", \"ns_per_op\": " << r.nsPerOp << ", \"items_per_op\": " << r.itemsPerOp
+               << ", \"ns_per_item\": " << r.nsPerOp / r.itemsPerOp << "}"
+               << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        os << "  ]\n}\n";
+    }
+
+    // --- Checks (fixed inputs, exact expectations) ---
+
+    bool expect(bool ok, const char *what)
+    {
+        std::cerr << (ok ? "ok     " : "FAILED ") << what << "\n";
+        return ok;
+    }
+
+    bool checkSweeps()
+    {
+        const AABB box{100.0f, 100.0f, 172.0f, 128.0f};
+        const float r = 8.0f;
+        const float diagonal = 1.0f / std::sqrt(2.0f);
+        bool ok = true;
+
+        // Centre in the top-left corner square of the expanded box (6, 6 from the corner:
+        // not touching), heading diagonally at the corner: contact on the rounded corner
+        {
+            float t = 0.0f;
+            Vec2 n;
+            const bool hit = Collision::sweepCircleAABB(Vec2(94.0f, 94.0f), Vec2(10.0f, 10.0f), r, box, t, n);
+            const float expectedT = (6.0f - r * diagonal) / 10.0f;
+            ok &= expect(hit && std::abs(t - expectedT) < 1e-4f &&
+                             std::abs(n.x + diagonal) < 1e-4f && std::abs(n.y + diagonal) < 1e-4f,
+                         "sweep from a corner square hits the corner");
+        }
+
+        // Same start, moving away: no contact
+        {
+            float t = 0.0f;
+            Vec2 n;
+            ok &= expect(!Collision::sweepCircleAABB(Vec2(94.0f, 94.0f), Vec2(-10.0f, -10.0f), r, box, t, n),
+                         "sweep from a corner square moving away misses");
+        }
+
+        // Start overlapping the box: left to the penetration test
+        {
+            float t = 0.0f;
+            Vec2 n;
+            ok &= expect(!Collision::sweepCircleAABB(Vec2(96.0f, 110.0f), Vec2(10.0f, 0.0f), r, box, t, n),
+                         "sweep starting in overlap reports nothing");
+        }
+
+        // Straight at the left face
+        {
+            float t = 0.0f;
+            Vec2 n;
+            const bool hit = Collision::sweepCircleAABB(Vec2(72.0f, 114.0f), Vec2(40.0f, 0.0f), r, box, t, n);
+            ok &= expect(hit && std::abs(t - 0.5f) < 1e-6f && n.x == -1.0f && n.y == 0.0f,
+                         "sweep at a face hits the face");
+        }
+
+        return ok;
+    }
+
+    // Every SIMD kernel against the scalar reference, bit for bit on the boxes it reports
+    bool checkBatchKernels()
+    {
+        std::mt19937 rng(777);
+        std::uniform_real_distribution<float> pos(0.0f, 200.0f);
+        std::uniform_real_distribution<float> ext(1.0f, 60.0f);
+
+        Collision::CircleRectBatch batch;
+        for (int i = 0; i < 1003; i++) // not a multiple of 8: the scalar tail runs too
+            batch.add(pos(rng), pos(rng), ext(rng), ext(rng));
+        batch.add(90.0f, 90.0f, 20.0f, 20.0f); // centre inside, equidistant sides
+        batch.add(108.0f, 80.0f, 10.0f, 40.0f); // edge exactly at the radius: no hit
+
+        const std::size_t n = batch.size();
+        const auto &kernels = Collision::batchKernels();
+        std::vector<std::uint8_t> refHit(n), hit(n);
+        std::vector<float> refNx(n), refNy(n), refPen(n), nx(n), ny(n), pen(n);
+
+        bool ok = true;
+        for (int probe = 0; probe < 64; probe++)
+        {
+            const float cx = probe == 0 ? 100.0f : pos(rng);
+            const float cy = probe == 0 ? 100.0f : pos(rng);
+            const float r = 8.0f;
+            const int refHits = Collision::circleRectBatchScalar(cx, cy, r, batch.x.data(), batch.y.data(), batch.w.data(),
+                                                                 batch.h.data(), n, refHit.data(), refNx.data(), refNy.data(),
+                                                                 refPen.data());
+            for (const Collision::BatchKernel &kernel : kernels)
+            {
+                const int hits = kernel.run(cx, cy, r, batch.x.data(), batch.y.data(), batch.w.data(), batch.h.data(), n,
+                                            hit.data(), nx.data(), ny.data(), pen.data());
+                bool same = hits == refHits && hit == refHit;
+                for (std::size_t i = 0; same && i < n; i++)
+                {
+                    if (refHit[i])
+                        same = std::memcmp(&nx[i], &refNx[i], sizeof(float)) == 0 &&
+                               std::memcmp(&ny[i], &refNy[i], sizeof(float)) == 0 &&
+                               std::memcmp(&pen[i], &refPen[i], sizeof(float)) == 0;
+                }
+                if (!same)
+                {
+                    std::cerr << "FAILED " << kernel.name << " differs from scalar (probe " << probe << ")\n";
+                    ok = false;
+                }
+            }
+        }
+
+        std::string names;
+        for (const Collision::BatchKernel &kernel : kernels)
+            names += std::string(names.empty() ? "" : ", ") + kernel.name;
+        return expect(ok, ("batch kernels match scalar (" + names + ")").c_str());
+    }
+
+    void printUsage()
+    {
+        std::cerr << "Usage: CasseBriques_bench [--format csv|json] [--out FILE] [--filter TEXT]\n"
+                     "                          [--min-time SECONDS] [--quick]\n"
+                     "       CasseBriques_bench --check\n";
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opt;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--format" && hasValue)
+            opt.format = argv[++i];
+        else if (arg == "--out" && hasValue)
+            opt.outPath = argv[++i];
+        else if (arg == "--filter" && hasValue)
+            opt.filter = argv[++i];
+        else if (arg == "--min-time" && hasValue)
+            opt.minTime = std::max(0.001, std::atof(argv[++i]));
+        else if (arg == "--quick")
+            opt.quick = true;
+        else if (arg == "--check")
+            opt.check = true;
+        else
+        {
+            printUsage();
+            return (arg == "--help" || arg == "-h") ? 0 : 1;
+        }
+    }
+    if (opt.format != "csv" && opt.format != "json")
+    {
+        printUsage();
+        return 1;
+    }
+    if (opt.check)
+    {
+        const bool sweeps = checkSweeps();
+        const bool kernels = checkBatchKernels();
+        return sweeps && kernels ? 0 : 1;
+    }
+
+    if (opt.quick)
+        opt.minTime = std::min(opt.minTime, 0.02);
+
+    // Brick counts from one game level (60) up to 100k; projectile counts around Reborn's caps
+    const std::vector<long> brickCounts = opt.quick ? std::vector<long>{60, 1000}
+                                                    : std::vector<long>{60, 600, 6000, 25000, 100000};
+    const std::vector<long> projectileCounts = opt.quick ? std::vector<long>{1, 5}
+                                                         : std::vector<long>{1, 5, 50, 500};
+
+    std::mt19937 rng(12345); // fixed seed: same inputs for every build
+    Runner runner(opt);
+
+    benchPrimitives(runner, rng);
+    benchBatchKernel(runner, brickCounts, rng);
+    benchFrameLoops(runner, brickCounts, projectileCounts, rng);
+    benchSimulations(runner);
+    benchLevels(runner, brickCounts, rng);
+
+    std::ofstream file;
+    if (!opt.outPath.empty())
+    {
+        file.open(opt.outPath);
+        if (!file)
+        {
+            std::cerr << "Cannot write " << opt.outPath << "\n";
+            return 1;
+        }
+    }
+    std::ostream &out = opt.outPath.empty() ? std::cout : file;
+
+    if (opt.format == "json")
+        writeJson(out, runner.getResults(), opt);
+    else
+        writeCsv(out, runner.getResults());
+
+    return 0;
+}
@@ -1,8 +1,8 @@
 #include "src/app/App.hpp"
 
-int main()
+int main(int argc, char **argv)
 {
-    App app;
+    App app(LaunchOptions::parse(argc, argv));
     app.run();
     return 0;
 }
@@ -1,28 +1,74 @@
 #include "App.hpp"
 
+#include "../core/Trace.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <string>
 
 // Scenes (implemented in src/scenes/)
+std::unique_ptr<IScene> makeLoadingScene(AppContext &ctx);
 std::unique_ptr<IScene> makeMainMenuScene(AppContext &ctx);
 std::unique_ptr<IScene> makeSettingsScene(AppContext &ctx);
 std::unique_ptr<IScene> makeClassicGameScene(AppContext &ctx);
 std::unique_ptr<IScene> makeRebornGameScene(AppContext &ctx);
+std::unique_ptr<IScene> makeRebornEndlessScene(AppContext &ctx);
+std::unique_ptr<IScene> makeStressScene(AppContext &ctx);
+
+static const char *sceneName(SceneId id)
+{
+    switch (id)
+    {
+    case SceneId::Loading:
+        return "loading";
+    case SceneId::MainMenu:
+        return "menu";
+    case SceneId::Settings:
+        return "settings";
+    case SceneId::ClassicGame:
+        return "classic";
+    case SceneId::RebornGame:
+        return "reborn";
+    case SceneId::RebornEndless:
+        return "reborn_endless";
+    case SceneId::Stress:
+        return "stress";
+    case SceneId::Quit:
+    default:
+        return "quit";
+    }
+}
 
-App::App()
+App::App(const LaunchOptions &options)
     : window(sf::VideoMode(800, 600), "Casse-Briques"),
-      ctx{window, assets, settings, requestedSceneId}
+      launch(options),
+      ctx{window, assets, settings, requestedSceneId, launch, startup, jobs}
 {
-    window.setFramerateLimit(60);
+    startup.add("window", 0.0, startup.now());
+
+    // Settings are tiny and needed for the first frame; assets load behind the loading
+    // scene, which then opens launch.startScene
+    {
+        StartupProfile::Phase phase(startup, "settings");
+        settings = Settings::loadFromFile("settings.ini");
+    }
+    assets.initAsync(&startup);
 
-    // Load settings + assets once
-    settings = Settings::loadFromFile("settings.ini");
-    assets.init();
+    frameRateSetting.store(settings.frameRate);
+    vsyncSetting.store(settings.vsync);
+    applyPacing();
 }
 
 std::unique_ptr<IScene> App::createScene(SceneId id)
 {
     switch (id)
     {
+    case SceneId::Loading:
+        return makeLoadingScene(ctx);
     case SceneId::MainMenu:
         return makeMainMenuScene(ctx);
     case SceneId::Settings:
@@ -31,6 +77,10 @@ std::unique_ptr<IScene> App::createScene(SceneId id)
         return makeClassicGameScene(ctx);
     case SceneId::RebornGame:
         return makeRebornGameScene(ctx);
+    case SceneId::RebornEndless:
+        return makeRebornEndlessScene(ctx);
+    case SceneId::Stress:
+        return makeStressScene(ctx);
     case SceneId::Quit:
     default:
         return nullptr;
@@ -39,49 +89,335 @@ std::unique_ptr<IScene> App::createScene(SceneId id)
 
 void App::run()
 {
+    TRACE_THREAD_NAME("main");
+
     requestedSceneId = currentSceneId;
-    scene = createScene(currentSceneId);
+    startScene();
+    input.update(window); // cursor position before the first mouse move
+    if (settings.inputSampleHz > 0)
+    {
+        mouseSampler.start(window, settings.inputSampleHz);
+        input.attach(&mouseSampler);
+    }
+    if (settings.latencyLog && !latency.openLog("latency_log.csv"))
+        std::cerr << "Could not open latency_log.csv\n";
+
+    // From here on the input manager and the scene's update() belong to the simulation side
+    if (settings.simulationThread)
+    {
+        simulationRunning.store(true, std::memory_order_release);
+        simulationThread = std::thread([this]
+                                       { simulationLoop(); });
+    }
 
-    sf::Clock clock;
     while (window.isOpen())
     {
-        // Scene transition requested?
-        if (requestedSceneId != currentSceneId)
-        {
-            // Persist settings when leaving settings screen (safe to do often)
-            settings.saveToFile("settings.ini");
+        TRACE_SCOPE("App::frame");
+
+        // Wait for the frame deadline first: events and mouse samples are then read as
+        // late as possible before the simulation steps that use them
+        applyPacing();
+        pacer.wait();
 
-            currentSceneId = requestedSceneId;
-            if (currentSceneId == SceneId::Quit)
-            {
-                window.close();
+        pollEvents();
+        if (!window.isOpen())
+            break;
+
+        if (!settings.simulationThread)
+            simulate();
+
+        // Scene change requested by the simulation side (which now waits for us)?
+        if (sceneChangePending.load(std::memory_order_acquire))
+        {
+            changeScene();
+            if (!window.isOpen())
                 break;
-            }
-            scene = createScene(currentSceneId);
         }
 
-        sf::Event event;
-        while (window.pollEvent(event))
+        renderFrame();
+
+        // Cold start ends with the first frame of the first real scene
+        if (currentSceneId != SceneId::Loading && !startup.isFinished())
+            reportStartup();
+    }
+
+    simulationRunning.store(false, std::memory_order_release);
+    if (simulationThread.joinable())
+        simulationThread.join();
+
+    input.attach(nullptr);
+    mouseSampler.stop();
+
+    if (Trace::isEnabled())
+        writeTrace();
+}
+
+void App::startScene()
+{
+    TRACE_SCOPE("App::createScene");
+    if (startup.isFinished() || currentSceneId == SceneId::Loading)
+        scene = createScene(currentSceneId);
+    else
+    {
+        StartupProfile::Phase phase(startup, "firstScene");
+        scene = createScene(currentSceneId);
+    }
+
+    // A frame of the initial state: the window never draws a default-constructed one
+    frames.reset([this]
+                 { return scene->createFrame(); });
+    accumulator = 0.0f;
+    lastSimulate = InputSampler::now();
+    publishFrame();
+}
+
+void App::changeScene()
+{
+    // Persist settings when leaving settings screen (safe to do often)
+    settings.saveToFile("settings.ini");
+
+    currentSceneId = requestedSceneId;
+    if (currentSceneId == SceneId::Quit)
+    {
+        window.close();
+        return;
+    }
+
+    startScene();
+    sceneChangePending.store(false, std::memory_order_release);
+}
+
+void App::pollEvents()
+{
+    TRACE_SCOPE("App::events");
+
+    // An event polled while the queue was full goes first; until it fits, the next ones
+    // wait in the window's queue
+    if (eventHeld)
+    {
+        if (!events.push(heldEvent))
+            return;
+        eventHeld = false;
+    }
+
+    sf::Event event;
+    while (window.pollEvent(event))
+    {
+        if (event.type == sf::Event::Closed)
         {
-            if (event.type == sf::Event::Closed)
-            {
-                window.close();
-                break;
-            }
+            window.close();
+            return;
+        }
+
+        // F3: input latency overlay
+        if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3)
+        {
+            showLatency = !showLatency;
+            continue;
+        }
+
+        // F9: dump the trace so far (only in CASSEBRIQUES_TRACING builds)
+        if (Trace::isEnabled() && event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F9)
+        {
+            writeTrace();
+            continue;
+        }
 
-            if (scene)
-                scene->handleEvent(event);
+        // Input and scenes are fed on the simulation side. Queue full (simulation stalled):
+        // keep this event for the next poll, never drop it (a lost release leaves a key held)
+        const TimedEvent timed{event, InputSampler::now()};
+        if (!events.push(timed))
+        {
+            heldEvent = timed;
+            eventHeld = true;
+            break;
         }
+    }
+}
+
+double App::simulate()
+{
+    TRACE_SCOPE("App::simulate");
+
+    const float step = 1.0f / static_cast<float>(settings.simulationHz);
+    if (sceneChangePending.load(std::memory_order_acquire))
+        return step;
+
+    while (const TimedEvent *e = events.front())
+    {
+        input.processEvent(e->event, e->time);
+        scene->handleEvent(e->event);
+        events.pop();
+    }
+
+    // Fixed-timestep simulation: physics never sees a frame-rate dependent dt.
+    // A long hitch (window drag, slow frame) is paid back with at most
+    // maxCatchUpSteps ticks; the rest of the backlog is dropped.
+    const double now = InputSampler::now();
+    accumulator += std::min(static_cast<float>(now - lastSimulate), 0.25f);
+    lastSimulate = now;
+
+    // The simulation lags real time by the accumulator: the next step covers
+    // [now - accumulator, now - accumulator + step], where its mouse samples are taken
+    int steps = 0;
+    while (accumulator >= step && steps < settings.maxCatchUpSteps && requestedSceneId == currentSceneId)
+    {
+        TRACE_SCOPE("App::update");
+        const InputSnapshot snapshot = input.takeSnapshot(now - accumulator, step);
+        scene->update(step, snapshot);
+        accumulator -= step;
+        steps++;
+        ticks++;
+    }
+    if (accumulator >= step)
+        accumulator = std::fmod(accumulator, step);
 
-        const float dt = clock.restart().asSeconds();
-        if (scene)
-            scene->update(dt);
+    // Input that reached the simulation (its latency ends when a frame showing it is displayed)
+    const double inputTime = steps > 0 ? input.takeInputTime() : 0.0;
+    if (inputTime > 0.0)
+    {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+        if (undisplayedInput == 0.0)
+        {
+            undisplayedInput = inputTime;
+            undisplayedUpdate = InputSampler::now();
+        }
+        undisplayedTick = ticks;
+    }
+
+    frameRateSetting.store(settings.frameRate, std::memory_order_relaxed);
+    vsyncSetting.store(settings.vsync, std::memory_order_relaxed);
+
+    if (requestedSceneId != currentSceneId)
+    {
+        // The window thread builds the next scene; nothing here touches the scene until then
+        sceneChangePending.store(true, std::memory_order_release);
+        return step;
+    }
+
+    publishFrame();
+    return step - accumulator;
+}
+
+void App::simulationLoop()
+{
+    TRACE_THREAD_NAME("simulation");
+
+    while (simulationRunning.load(std::memory_order_acquire))
+    {
+        // Wake up when the next step is due
+        const double wait = simulate();
+        std::this_thread::sleep_for(std::chrono::duration<double>(std::max(wait, 0.0)));
+    }
+}
+
+void App::publishFrame()
+{
+    TRACE_SCOPE("App::capture");
 
+    SceneFrame &frame = *frames.back();
+    frame.tick = ticks;
+    frame.time = lastSimulate - accumulator;
+    scene->capture(frame);
+    frames.publish();
+}
+
+void App::renderFrame()
+{
+    frames.update();
+    const SceneFrame &frame = *frames.front();
+
+    // Time since the captured step, as a fraction of a step (the simulation side may be
+    // on another thread: measured here rather than handed over)
+    const double step = 1.0 / settings.simulationHz;
+    const float alpha = static_cast<float>(std::max(0.0, std::min((InputSampler::now() - frame.time) / step, 1.0)));
+
+    {
+        TRACE_SCOPE("App::render");
         window.clear(sf::Color(15, 15, 25));
-        if (scene)
-            scene->render(window);
+        scene->render(window, frame, alpha);
+        if (showLatency)
+            drawLatency();
+    }
+    {
+        TRACE_SCOPE("App::display");
         window.display();
     }
+
+    // Input shown for the first time by this frame
+    double inputTime = 0.0;
+    double updateTime = 0.0;
+    {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+        if (undisplayedInput > 0.0 && frame.tick >= undisplayedTick)
+        {
+            inputTime = undisplayedInput;
+            updateTime = undisplayedUpdate;
+            undisplayedInput = 0.0;
+        }
+    }
+    latency.frameDisplayed(inputTime, updateTime, InputSampler::now(), sceneName(currentSceneId), pacing);
+}
+
+void App::reportStartup()
+{
+    startup.finish();
+    startup.print(std::cout);
+
+    // One row per launch, next to settings.ini
+    if (!startup.appendCsv("startup_profile.csv"))
+        std::cerr << "Could not write startup_profile.csv\n";
+}
+
+void App::applyPacing()
+{
+    // Settings may change from the settings scene: only touch the window on a change
+    const int frameRate = frameRateSetting.load(std::memory_order_relaxed);
+    const bool vsync = vsyncSetting.load(std::memory_order_relaxed);
+    if (frameRate != pacer.getTargetHz() || pacing.empty())
+        pacer.setTargetHz(frameRate);
+    if (vsync != vsyncApplied || pacing.empty())
+    {
+        window.setVerticalSyncEnabled(vsync);
+        vsyncApplied = vsync;
+    }
+
+    const std::string rate = pacer.getTargetHz() > 0 ? std::to_string(pacer.getTargetHz()) + "hz" : "uncapped";
+    pacing = vsyncApplied ? "vsync+" + rate : rate;
 }
 
+void App::drawLatency()
+{
+    // The font belongs to the asset loader until it is done
+    if (currentSceneId == SceneId::Loading || !assets.uiFontLoaded)
+        return;
+
+    const LatencyMonitor::Stats &s = latency.last();
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(1) << "Input latency ms  p50 " << s.p50 << "  p90 " << s.p90
+       << "  p99 " << s.p99 << "  max " << s.max << "  | update " << s.updateP50 << " + display "
+       << s.displayP50 << "  | " << s.samples << "/" << s.frames << "\n"
+       << "Frame time ms  mean " << s.frameMean << "  sd " << std::setprecision(2) << s.frameStdDev
+       << "  max " << std::setprecision(1) << s.frameMax << "  | " << pacing;
 
+    sf::Text t(ss.str(), assets.uiFont, 15);
+    t.setFillColor(sf::Color(120, 255, 160));
+    t.setPosition(10.0f, 556.0f);
+
+    const sf::FloatRect b = t.getGlobalBounds();
+    sf::RectangleShape bg(sf::Vector2f(b.width + 12.0f, 42.0f));
+    bg.setPosition(4.0f, 554.0f);
+    bg.setFillColor(sf::Color(0, 0, 0, 170));
+    window.draw(bg);
+    window.draw(t);
+}
+
+void App::writeTrace()
+{
+    // trace_1.json, trace_2.json, ... next to settings.ini
+    const std::string path = "trace_" + std::to_string(++traceDumps) + ".json";
+    if (Trace::writeChromeJson(path))
+        std::cout << "Trace written to " << path << " (" << Trace::eventCount() << " events)\n";
+    else
+        std::cerr << "Could not write trace file " << path << "\n";
+}
@@ -2,11 +2,23 @@
 
 #include <SFML/Graphics.hpp>
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 
+#include "../core/FramePacer.hpp"
+#include "../core/JobSystem.hpp"
+#include "../core/SpscQueue.hpp"
+#include "../core/TripleBuffer.hpp"
 #include "Assets.hpp"
+#include "LatencyMonitor.hpp"
+#include "LaunchOptions.hpp"
 #include "Scene.hpp"
 #include "Settings.hpp"
+#include "StartupProfile.hpp"
 
 struct AppContext
 {
@@ -14,25 +26,81 @@ struct AppContext
     Assets &assets;
     Settings &settings;
     SceneId &requestedScene;
+    LaunchOptions &launch; // command line (stress scene counts, start scene)
+    StartupProfile &startup;
+    JobSystem &jobs; // per-step work split across cores (stress scene)
 };
 
 class App
 {
 public:
-    App();
+    explicit App(const LaunchOptions &options = LaunchOptions());
     void run();
 
 private:
+    StartupProfile startup; // first member: its clock starts before the window opens
     sf::RenderWindow window;
     Assets assets;
     Settings settings;
+    LaunchOptions launch;
+    InputManager input; // fed by the event loop, one snapshot per simulation step
+    InputSampler mouseSampler; // timestamped mouse on its own thread (Settings::inputSampleHz)
 
-    SceneId currentSceneId = SceneId::MainMenu;
-    SceneId requestedSceneId = SceneId::MainMenu;
+    FramePacer pacer; // Settings::frameRate (replaces setFramerateLimit)
+    bool vsyncApplied = false;
+    std::string pacing; // frame pacing in use, for the latency log
+    // Settings::frameRate / vsync as last seen by the simulation side (the settings scene edits them)
+    std::atomic<int> frameRateSetting{60};
+    std::atomic<bool> vsyncSetting{false};
+
+    LatencyMonitor latency;
+    bool showLatency = false; // F3
+
+    JobSystem jobs; // before the scene: outlives it
+
+    SceneId currentSceneId = SceneId::Loading;
+    SceneId requestedSceneId = SceneId::Loading;
     AppContext ctx;
     std::unique_ptr<IScene> scene;
 
+    // Simulation side (its own thread with Settings::simulationThread): events, steps, capture.
+    // The window thread polls events, draws the latest frame and performs scene changes.
+    struct TimedEvent
+    {
+        sf::Event event;
+        double time = 0.0; // InputSampler::now() when polled
+    };
+    SpscQueue<TimedEvent> events{256}; // window thread -> simulation side
+    TimedEvent heldEvent; // polled while the queue was full, pushed first next time
+    bool eventHeld = false;
+    TripleBuffer<std::unique_ptr<SceneFrame>> frames;
+    std::thread simulationThread;
+    std::atomic<bool> simulationRunning{false};
+    std::atomic<bool> sceneChangePending{false}; // simulation side waits for the window thread
+    float accumulator = 0.0f;                    // simulation time owed, seconds
+    double lastSimulate = 0.0;
+    std::uint64_t ticks = 0; // steps run since launch
+
+    // Input simulated but not displayed yet (latency), handed to the window thread
+    std::mutex latencyMutex;
+    double undisplayedInput = 0.0;
+    double undisplayedUpdate = 0.0;
+    std::uint64_t undisplayedTick = 0;
+
+    int traceDumps = 0; // Chrome trace files written this session
+
     std::unique_ptr<IScene> createScene(SceneId id);
+    void changeScene();
+    void startScene();
+    void pollEvents();
+    double simulate();
+    void simulationLoop();
+    void publishFrame();
+    void renderFrame();
+    void writeTrace();
+    void reportStartup();
+    void drawLatency();
+    void applyPacing();
 };
 
 
@@ -1,5 +1,8 @@
 #include "Assets.hpp"
 
+#include "../core/Trace.hpp"
+
+#include <chrono>
 #include <iostream>
 
 static bool looksLikeRoot(const std::filesystem::path &p)
@@ -25,6 +28,34 @@ static std::filesystem::path findRootDir()
     return std::filesystem::current_path();
 }
 
+static void loadLevels(Assets &assets)
+{
+    const auto t0 = std::chrono::steady_clock::now();
+    std::string error;
+
+    const std::filesystem::path pack = assets.levelsDir() / "levels.cblp";
+    const std::filesystem::path text = assets.levelsDir() / "level1.txt";
+    const char *source = "built-in";
+    if (std::filesystem::exists(pack))
+    {
+        if (assets.levelPack.open(pack.string(), error))
+            source = "levels.cblp";
+        else
+            std::cerr << "[Assets] " << error << "\n";
+    }
+    if (assets.levelPack.size() == 0 && std::filesystem::exists(text))
+    {
+        if (Level::loadText(text.string(), assets.textLevel, error))
+            source = "level1.txt";
+        else
+            std::cerr << "[Assets] " << error << "\n";
+    }
+
+    const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    const LevelGrid level = assets.startLevel();
+    std::cout << "[Assets] level=" << source << " (" << level.rows << "x" << level.cols << ", " << us << " us)\n";
+}
+
 static bool tryLoadFont(sf::Font &font, const std::filesystem::path &p)
 {
     if (!std::filesystem::exists(p))
@@ -32,27 +63,97 @@ static bool tryLoadFont(sf::Font &font, const std::filesystem::path &p)
     return font.loadFromFile(p.string());
 }
 
-void Assets::init()
+// Runs one loading step, timed in the startup profile when there is one
+template <typename F>
+static void timedStep(StartupProfile *profile, const char *name, F &&fn)
+{
+    const double start = profile ? profile->now() : 0.0;
+    fn();
+    if (profile)
+        profile->add(name, start, profile->now());
+}
+
+// Character sizes used by the scenes (HUD, hints, buttons, labels) and the bold titles
+static const unsigned REGULAR_SIZES[] = {15, 16, 18, 26, 28};
+static const unsigned BOLD_SIZES[] = {56, 64};
+static constexpr int LOAD_STEPS = 3;
+
+Assets::~Assets()
 {
-    rootDir = findRootDir();
+    if (loader.joinable())
+        loader.join();
+}
+
+void Assets::init(StartupProfile *profile)
+{
+    TRACE_SCOPE("Assets::init");
+
+    timedStep(profile, "assets.rootDir", [&]
+              { rootDir = findRootDir(); });
+    stepsDone++;
 
-    // Try bundled font first (if user adds one later)
-    uiFontLoaded = tryLoadFont(uiFont, assetsDir() / "fonts" / "arial.ttf");
+    timedStep(profile, "assets.fonts", [&]
+              {
+                  // Try bundled font first (if user adds one later)
+                  uiFontLoaded = tryLoadFont(uiFont, assetsDir() / "fonts" / "arial.ttf");
 
 #ifdef _WIN32
-    // Windows system fonts fallback
-    if (!uiFontLoaded)
-        uiFontLoaded = tryLoadFont(uiFont, "C:/Windows/Fonts/segoeui.ttf");
-    if (!uiFontLoaded)
-        uiFontLoaded = tryLoadFont(uiFont, "C:/Windows/Fonts/arial.ttf");
-    if (!uiFontLoaded)
-        uiFontLoaded = tryLoadFont(uiFont, "C:/Windows/Fonts/calibri.ttf");
+                  // Windows system fonts fallback
+                  if (!uiFontLoaded)
+                      uiFontLoaded = tryLoadFont(uiFont, "C:/Windows/Fonts/segoeui.ttf");
+                  if (!uiFontLoaded)
+                      uiFontLoaded = tryLoadFont(uiFont, "C:/Windows/Fonts/arial.ttf");
+                  if (!uiFontLoaded)
+                      uiFontLoaded = tryLoadFont(uiFont, "C:/Windows/Fonts/calibri.ttf");
 #endif
+              });
+    stepsDone++;
+
+    timedStep(profile, "assets.levels", [&]
+              { loadLevels(*this); });
+    stepsDone++;
 
     // Diagnostics (dev-friendly)
     std::cout << "[Assets] cwd=" << std::filesystem::current_path().string() << "\n";
     std::cout << "[Assets] rootDir=" << rootDir.string() << "\n";
     std::cout << "[Assets] uiFontLoaded=" << (uiFontLoaded ? "true" : "false") << "\n";
+
+    loaded.store(true, std::memory_order_release);
+}
+
+void Assets::initAsync(StartupProfile *profile)
+{
+    loader = std::thread([this, profile]
+                         {
+                             TRACE_THREAD_NAME("assets");
+                             init(profile); });
+}
+
+bool Assets::isReady()
+{
+    if (!loaded.load(std::memory_order_acquire))
+        return false;
+    if (loader.joinable())
+        loader.join();
+    return true;
 }
 
+float Assets::progress() const
+{
+    return static_cast<float>(stepsDone.load()) / static_cast<float>(LOAD_STEPS);
+}
 
+void Assets::prewarmGlyphs()
+{
+    TRACE_SCOPE("Assets::prewarmGlyphs");
+    if (!uiFontLoaded)
+        return;
+
+    // Printable ASCII covers every string the HUD and overlays build
+    for (const unsigned size : REGULAR_SIZES)
+        for (sf::Uint32 c = 32; c < 127; c++)
+            uiFont.getGlyph(c, size, false);
+    for (const unsigned size : BOLD_SIZES)
+        for (sf::Uint32 c = 32; c < 127; c++)
+            uiFont.getGlyph(c, size, true);
+}
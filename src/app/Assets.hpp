@@ -2,7 +2,12 @@
 
 #include <SFML/Graphics.hpp>
 
+#include <atomic>
 #include <filesystem>
+#include <thread>
+
+#include "../level/Level.hpp"
+#include "StartupProfile.hpp"
 
 struct Assets
 {
@@ -11,11 +16,38 @@ struct Assets
 
     std::filesystem::path rootDir; // directory that contains assets/ and levels/
 
-    // Finds a usable root dir (walks upward from cwd) and tries to load fonts.
-    void init();
+    // Compiled pack (levels/levels.cblp, memory-mapped) or, without one, levels/level1.txt
+    LevelPack levelPack;
+    Level textLevel;
+
+    Assets() = default;
+    ~Assets(); // waits for a running loader
+    Assets(const Assets &) = delete;
+    Assets &operator=(const Assets &) = delete;
+
+    // Finds a usable root dir (walks upward from cwd), tries to load fonts, loads levels.
+    // Each step is recorded in profile when given.
+    void init(StartupProfile *profile = nullptr);
+
+    // init() on a worker thread; nothing above may be read until isReady() returns true.
+    void initAsync(StartupProfile *profile = nullptr);
+    bool isReady();         // joins the loader once it is done
+    float progress() const; // 0..1, for the loading screen
+
+    // Rasterizes the glyphs of the HUD / overlay / button sizes so the first frames of a
+    // scene don't stall on font rendering. Creates textures: call from the render thread.
+    void prewarmGlyphs();
 
     std::filesystem::path assetsDir() const { return rootDir / "assets"; }
     std::filesystem::path levelsDir() const { return rootDir / "levels"; }
+
+    // Grid the game scenes start with (empty: each mode's built-in grid)
+    LevelGrid startLevel() const { return levelPack.size() > 0 ? levelPack.level(0) : textLevel.grid(); }
+
+private:
+    std::thread loader;
+    std::atomic<int> stepsDone{0};
+    std::atomic<bool> loaded{false};
 };
 
 
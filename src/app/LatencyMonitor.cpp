@@ -0,0 +1,122 @@
+#include "LatencyMonitor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <filesystem>
+#include <iomanip>
+
+LatencyMonitor::LatencyMonitor()
+{
+    // Fixed capacity: recording a frame never allocates
+    total.reserve(MAX_SAMPLES);
+    update.reserve(MAX_SAMPLES);
+    display.reserve(MAX_SAMPLES);
+    scratch.reserve(MAX_SAMPLES);
+}
+
+bool LatencyMonitor::openLog(const std::string &path)
+{
+    std::error_code ec;
+    const bool isNew = !std::filesystem::exists(path, ec);
+    log.open(path, std::ios::app);
+    if (!log.is_open())
+        return false;
+
+    if (isNew)
+        log << "timestamp,scene,pacing,frames,samples,p50_ms,p90_ms,p99_ms,max_ms,update_p50_ms,display_p50_ms,"
+               "frame_mean_ms,frame_sd_ms,frame_max_ms\n";
+    return true;
+}
+
+void LatencyMonitor::frameDisplayed(double inputTime, double updateTime, double displayTime,
+                                    const char *scene, const std::string &pacing)
+{
+    if (periodStart == 0.0)
+        periodStart = displayTime;
+
+    frames++;
+    if (lastDisplay > 0.0)
+    {
+        const double dt = displayTime - lastDisplay;
+        intervals++;
+        intervalSum += dt;
+        intervalSumSq += dt * dt;
+        intervalMax = std::max(intervalMax, dt);
+    }
+    lastDisplay = displayTime;
+
+    if (inputTime > 0.0 && total.size() < MAX_SAMPLES)
+    {
+        total.push_back(static_cast<float>(displayTime - inputTime));
+        update.push_back(static_cast<float>(updateTime - inputTime));
+        display.push_back(static_cast<float>(displayTime - updateTime));
+    }
+
+    if (displayTime - periodStart >= REPORT_PERIOD)
+    {
+        publish(scene, pacing);
+        periodStart = displayTime;
+    }
+}
+
+double LatencyMonitor::percentile(const std::vector<float> &values, double p)
+{
+    if (values.empty())
+        return 0.0;
+
+    // Nearest rank on a copy: the recorded order is kept for the other percentiles
+    scratch.assign(values.begin(), values.end());
+    const double n = static_cast<double>(scratch.size());
+    const std::size_t rank = static_cast<std::size_t>(std::max(0.0, std::min(std::ceil(p * n) - 1.0, n - 1.0)));
+    std::nth_element(scratch.begin(), scratch.begin() + static_cast<std::ptrdiff_t>(rank), scratch.end());
+    return scratch[rank] * 1000.0;
+}
+
+void LatencyMonitor::publish(const char *scene, const std::string &pacing)
+{
+    stats.frames = frames;
+    stats.samples = static_cast<int>(total.size());
+    stats.p50 = percentile(total, 0.50);
+    stats.p90 = percentile(total, 0.90);
+    stats.p99 = percentile(total, 0.99);
+    stats.max = percentile(total, 1.0);
+    stats.updateP50 = percentile(update, 0.50);
+    stats.displayP50 = percentile(display, 0.50);
+
+    stats.frameMean = stats.frameStdDev = stats.frameMax = 0.0;
+    if (intervals > 0)
+    {
+        const double mean = intervalSum / intervals;
+        const double variance = std::max(0.0, intervalSumSq / intervals - mean * mean);
+        stats.frameMean = mean * 1000.0;
+        stats.frameStdDev = std::sqrt(variance) * 1000.0;
+        stats.frameMax = intervalMax * 1000.0;
+    }
+
+    if (log.is_open())
+    {
+        const std::time_t t = std::time(nullptr);
+        std::tm local{};
+#if defined(_WIN32)
+        localtime_s(&local, &t);
+#else
+        localtime_r(&t, &local);
+#endif
+        char stamp[32];
+        std::strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%S", &local);
+
+        log << stamp << ',' << scene << ',' << pacing << ',' << stats.frames << ',' << stats.samples
+            << std::fixed << std::setprecision(2) << ',' << stats.p50 << ',' << stats.p90 << ',' << stats.p99
+            << ',' << stats.max << ',' << stats.updateP50 << ',' << stats.displayP50 << ',' << stats.frameMean
+            << ',' << stats.frameStdDev << ',' << stats.frameMax << '\n';
+        log.flush(); // kiosks are switched off, not quit
+    }
+
+    frames = 0;
+    intervals = 0;
+    intervalSum = intervalSumSq = intervalMax = 0.0;
+    total.clear();
+    update.clear();
+    display.clear();
+}
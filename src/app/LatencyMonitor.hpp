@@ -0,0 +1,70 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Input-to-photon latency: for every frame that consumed input, the time from the oldest
+// input (event polled in App::run, or mouse sample) to the return of window.display(),
+// split at the end of the simulation steps that used it. Also the spread of frame times
+// (display to display), to judge frame pacing. Published once per report period, for the
+// overlay (F3) and optionally as one CSV line per period.
+class LatencyMonitor
+{
+public:
+    struct Stats
+    {
+        int frames = 0;  // frames rendered in the period
+        int samples = 0; // frames that carried input
+        double p50 = 0.0; // input -> display, ms
+        double p90 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+        double updateP50 = 0.0;  // input -> end of its simulation steps, ms
+        double displayP50 = 0.0; // end of steps -> display returned (render, swap, vsync), ms
+
+        double frameMean = 0.0; // display -> next display, ms
+        double frameStdDev = 0.0;
+        double frameMax = 0.0;
+    };
+
+    static constexpr double REPORT_PERIOD = 1.0; // seconds
+    static constexpr std::size_t MAX_SAMPLES = 4096; // per period; later frames are not counted
+
+    LatencyMonitor();
+
+    // CSV: timestamp,scene,pacing,frames,samples,p50_ms,p90_ms,p99_ms,max_ms,update_p50_ms,display_p50_ms,
+    //      frame_mean_ms,frame_sd_ms,frame_max_ms
+    bool openLog(const std::string &path);
+    bool isLogging() const { return log.is_open(); }
+
+    // One call per displayed frame (times on InputSampler::now()'s clock).
+    // inputTime 0: no input reached the simulation this frame.
+    // scene / pacing label the log line (scene name, frame-rate limit / vsync).
+    void frameDisplayed(double inputTime, double updateTime, double displayTime,
+                        const char *scene, const std::string &pacing);
+
+    // Last completed period
+    const Stats &last() const { return stats; }
+
+private:
+    std::vector<float> total;   // input -> display, seconds
+    std::vector<float> update;  // input -> end of steps
+    std::vector<float> display; // end of steps -> display
+    std::vector<float> scratch;
+    int frames = 0;
+    double periodStart = 0.0;
+
+    // Frame times of the period (running sums: no storage)
+    double lastDisplay = 0.0;
+    int intervals = 0;
+    double intervalSum = 0.0;
+    double intervalSumSq = 0.0;
+    double intervalMax = 0.0;
+
+    Stats stats;
+    std::ofstream log;
+
+    void publish(const char *scene, const std::string &pacing);
+    double percentile(const std::vector<float> &values, double p);
+};
@@ -0,0 +1,93 @@
+#include "LaunchOptions.hpp"
+
+#include <iostream>
+
+static bool parseCount(const char *text, int &out)
+{
+    try
+    {
+        std::size_t used = 0;
+        const int v = std::stoi(text, &used);
+        if (text[used] != '\0' || v < 0)
+            return false;
+        out = v;
+        return true;
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
+LaunchOptions LaunchOptions::parse(int argc, char **argv)
+{
+    LaunchOptions o;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        int *count = nullptr;
+        if (arg == "--bricks")
+            count = &o.stress.bricks;
+        else if (arg == "--projectiles")
+            count = &o.stress.projectiles;
+        else if (arg == "--balls")
+            count = &o.stress.balls;
+
+        if (arg == "--stress")
+        {
+            o.startScene = SceneId::Stress;
+        }
+        else if (arg == "--autoplay")
+        {
+            o.autoplay = true;
+            if (o.startScene != SceneId::RebornEndless)
+                o.startScene = SceneId::RebornGame;
+        }
+        else if (arg == "--endless")
+        {
+            o.startScene = SceneId::RebornEndless;
+        }
+        else if (count && hasValue)
+        {
+            if (!parseCount(argv[++i], *count))
+                std::cerr << "Invalid value for " << arg << ": " << argv[i] << "\n";
+        }
+        else if (arg == "--replay" && hasValue)
+        {
+            std::string error;
+            const char *path = argv[++i];
+            if (Replay::loadFromFile(path, o.replay, error))
+            {
+                o.playReplay = true;
+                if (o.replay.header.mode == ReplayMode::Classic)
+                    o.startScene = SceneId::ClassicGame;
+                else
+                    o.startScene = o.replay.header.endless ? SceneId::RebornEndless : SceneId::RebornGame;
+            }
+            else
+            {
+                std::cerr << "Cannot play replay " << path << ": " << error << "\n";
+            }
+        }
+        else if (arg == "--help" || arg == "-h")
+        {
+            std::cout << usage();
+        }
+        else
+        {
+            std::cerr << "Unknown argument: " << arg << "\n"
+                      << usage();
+        }
+    }
+
+    o.stress.clamp();
+    return o;
+}
+
+std::string LaunchOptions::usage()
+{
+    return "Usage: CasseBriques [--stress] [--bricks N] [--projectiles N] [--balls N] [--replay FILE] [--autoplay] [--endless]\n";
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+
+#include "../replay/Replay.hpp"
+#include "../stress/StressConfig.hpp"
+#include "Scene.hpp"
+
+/**
+ * @brief Options de la ligne de commande
+ *
+ *   CasseBriques [--stress] [--bricks N] [--projectiles N] [--balls N] [--replay FILE] [--autoplay] [--endless]
+ *
+ * --stress ouvre directement la scène de test de charge ; les compteurs règlent
+ * son champ de départ (aussi modifiables en jeu).
+ * --replay charge un enregistrement (.cbr) et ouvre le mode de jeu correspondant
+ * en lecture ; la scène le consomme à sa création.
+ * --autoplay ouvre le mode Reborn joué par bots/RebornAutoplayer (démonstration,
+ * test d'endurance) ; Tab l'active ou le coupe en jeu.
+ * --endless ouvre le mode Reborn sans fin (avec --autoplay : session d'endurance).
+ */
+struct LaunchOptions
+{
+    SceneId startScene = SceneId::MainMenu;
+    StressConfig stress;
+
+    bool playReplay = false;
+    Replay replay;
+
+    bool autoplay = false;
+
+    /**
+     * @brief Analyse argv ; les arguments inconnus sont signalés sur stderr et ignorés
+     */
+    static LaunchOptions parse(int argc, char **argv);
+
+    static std::string usage();
+};
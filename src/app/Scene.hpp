@@ -2,26 +2,59 @@
 
 #include <SFML/Graphics.hpp>
 
+#include <cstdint>
+#include <memory>
+
+#include "../core/InputManager.hpp"
+
 struct AppContext;
 
 enum class SceneId
 {
+    Loading, // assets loading on a worker thread, then launch.startScene
     MainMenu,
     Settings,
     ClassicGame,
     RebornGame,
+    RebornEndless,
+    Stress,
     Quit,
 };
 
+// What the render side draws: a copy of the scene state after a simulation step.
+// Scenes derive their own frame type; App keeps three of them in a triple buffer.
+struct SceneFrame
+{
+    virtual ~SceneFrame() = default;
+
+    std::uint64_t tick = 0; // steps run when captured
+    double time = 0.0;      // wall time (InputSampler::now()) of the state, for interpolation
+};
+
+// Threading (Settings::simulationThread): handleEvent, update and capture run on the
+// simulation thread; the constructor, destructor and render run on the window thread,
+// never while the simulation thread is inside the scene. render() must only read its
+// frame and state that update() does not touch (text, render caches).
 class IScene
 {
 public:
     explicit IScene(AppContext &ctx) : ctx(ctx) {}
     virtual ~IScene() = default;
 
-    virtual void handleEvent(const sf::Event &event) = 0;
-    virtual void update(float dt) = 0;
-    virtual void render(sf::RenderTarget &target) = 0;
+    // Raw window events, for UI that wants key repeat (menu navigation).
+    // Gameplay reads the snapshot given to update() instead.
+    virtual void handleEvent(const sf::Event &) {}
+    // Called at a fixed rate (Settings::simulationHz); dt is always the fixed step.
+    // input: keys/buttons held and pressed/released since the previous step.
+    virtual void update(float dt, const InputSnapshot &input) = 0;
+
+    // The frame type filled by capture(); called three times per scene.
+    virtual std::unique_ptr<SceneFrame> createFrame() const { return std::make_unique<SceneFrame>(); }
+    // Copy what render() needs into frame (a frame from createFrame()), after the steps.
+    virtual void capture(SceneFrame &) const {}
+    // frame: the latest captured one (drawn again if no step ran since).
+    // alpha: fraction of a step elapsed since that step (0..1), for interpolation.
+    virtual void render(sf::RenderTarget &target, const SceneFrame &frame, float alpha) = 0;
 
 protected:
     AppContext &ctx;
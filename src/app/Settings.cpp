@@ -1,5 +1,6 @@
 #include "Settings.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 
@@ -69,6 +70,64 @@ Settings Settings::loadFromFile(const std::string &path)
         {
             s.difficulty = parseDifficulty(value);
         }
+        else if (key == "simulationHz")
+        {
+            try
+            {
+                s.simulationHz = std::max(30, std::min(std::stoi(value), 1000));
+            }
+            catch (...)
+            {
+            }
+        }
+        else if (key == "recordReplays")
+        {
+            s.recordReplays = (value == "1" || value == "true");
+        }
+        else if (key == "frameRate")
+        {
+            try
+            {
+                const int fps = std::stoi(value);
+                s.frameRate = (fps <= 0) ? 0 : std::max(30, std::min(fps, 500));
+            }
+            catch (...)
+            {
+            }
+        }
+        else if (key == "vsync")
+        {
+            s.vsync = (value == "1" || value == "true");
+        }
+        else if (key == "latencyLog")
+        {
+            s.latencyLog = (value == "1" || value == "true");
+        }
+        else if (key == "inputSampleHz")
+        {
+            try
+            {
+                const int hz = std::stoi(value);
+                s.inputSampleHz = (hz <= 0) ? 0 : std::max(100, std::min(hz, 8000));
+            }
+            catch (...)
+            {
+            }
+        }
+        else if (key == "simulationThread")
+        {
+            s.simulationThread = (value == "1" || value == "true");
+        }
+        else if (key == "maxCatchUpSteps")
+        {
+            try
+            {
+                s.maxCatchUpSteps = std::max(1, std::min(std::stoi(value), 64));
+            }
+            catch (...)
+            {
+            }
+        }
     }
 
     return s;
@@ -83,6 +142,14 @@ void Settings::saveToFile(const std::string &path) const
     out << "# CasseBriques settings\n";
     out << "masterVolume=" << masterVolume << "\n";
     out << "difficulty=" << difficultyToString(difficulty) << "\n";
+    out << "simulationHz=" << simulationHz << "\n";
+    out << "maxCatchUpSteps=" << maxCatchUpSteps << "\n";
+    out << "simulationThread=" << (simulationThread ? 1 : 0) << "\n";
+    out << "frameRate=" << frameRate << "\n";
+    out << "vsync=" << (vsync ? 1 : 0) << "\n";
+    out << "recordReplays=" << (recordReplays ? 1 : 0) << "\n";
+    out << "inputSampleHz=" << inputSampleHz << "\n";
+    out << "latencyLog=" << (latencyLog ? 1 : 0) << "\n";
 }
 
 
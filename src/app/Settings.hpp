@@ -1,20 +1,43 @@
 #pragma once
 
-#include <cstdint>
 #include <string>
 
-enum class Difficulty : std::uint8_t
-{
-    Easy = 0,
-    Normal = 1,
-    Hard = 2,
-};
+#include "../core/Difficulty.hpp"
 
 struct Settings
 {
     float masterVolume = 0.7f; // 0..1
     Difficulty difficulty = Difficulty::Normal;
 
+    // Fixed-timestep simulation (see App::run)
+    int simulationHz = 120;  // simulation ticks per second (30..1000)
+    int maxCatchUpSteps = 8; // max ticks per rendered frame before dropping time
+    // Steps on their own thread (see App::simulate): a slow frame no longer delays them.
+    // 0 = update and render in turn on the window thread.
+    bool simulationThread = true;
+
+    // Frame pacing (see FramePacer): target frame rate, 0 = uncapped (with vsync: the
+    // display's rate). Vsync and a cap can be combined.
+    int frameRate = 60; // 0 or 30..500 (menu: 60 / 120 / 144 / uncapped)
+    bool vsync = false;
+
+    // Save every game's inputs under replays/ (see Replay). Off by default: one file per
+    // game, never cleaned up.
+    bool recordReplays = false;
+
+    // Mouse sampling thread (see InputSampler): timestamped clicks and cursor positions,
+    // so a shot leaves at the sub-step it was clicked. 0 = off (window events only).
+    // Off by default where SFML's mouse queries are not safe away from the window thread.
+#if defined(_WIN32)
+    int inputSampleHz = 1000; // 100..8000
+#else
+    int inputSampleHz = 0;
+#endif
+
+    // Input-to-photon latency percentiles and frame-time spread, one line per second in
+    // latency_log.csv (F3 shows them in game either way)
+    bool latencyLog = false;
+
     static Settings loadFromFile(const std::string &path);
     void saveToFile(const std::string &path) const;
 };
@@ -0,0 +1,91 @@
+#include "StartupProfile.hpp"
+
+#include <algorithm>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+
+double StartupProfile::now() const
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - origin).count();
+}
+
+void StartupProfile::add(const std::string &name, double start, double end)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.push_back(Entry{name, start, end});
+}
+
+void StartupProfile::finish()
+{
+    const double t = now();
+    std::lock_guard<std::mutex> lock(mutex);
+    if (total == 0.0)
+        total = t;
+}
+
+bool StartupProfile::isFinished() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return total > 0.0;
+}
+
+void StartupProfile::print(std::ostream &os) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Timeline order: loader phases overlap the main thread's
+    std::vector<Entry> sorted = entries;
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Entry &a, const Entry &b)
+                     { return a.start < b.start; });
+
+    os << "[Startup] first frame after " << std::fixed << std::setprecision(1) << total * 1000.0 << " ms\n";
+    for (const Entry &e : sorted)
+    {
+        os << "[Startup]   " << std::left << std::setw(18) << e.name << std::right
+           << " at " << std::setw(7) << e.start * 1000.0 << " ms  took " << std::setw(7)
+           << (e.end - e.start) * 1000.0 << " ms\n";
+    }
+    os.unsetf(std::ios::floatfield);
+}
+
+bool StartupProfile::appendCsv(const std::string &path) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Columns by phase name: stable whatever order the threads finished in
+    std::vector<Entry> sorted = entries;
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Entry &a, const Entry &b)
+                     { return a.name < b.name; });
+
+    std::error_code ec;
+    const bool isNew = !std::filesystem::exists(path, ec);
+    std::ofstream file(path, std::ios::app);
+    if (!file.is_open())
+        return false;
+
+    if (isNew)
+    {
+        file << "timestamp,total_ms";
+        for (const Entry &e : sorted)
+            file << ',' << e.name << "_ms";
+        file << '\n';
+    }
+
+    const std::time_t t = std::time(nullptr);
+    std::tm local{};
+#if defined(_WIN32)
+    localtime_s(&local, &t);
+#else
+    localtime_r(&t, &local);
+#endif
+    char stamp[32];
+    std::strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%S", &local);
+
+    file << stamp << std::fixed << std::setprecision(3) << ',' << total * 1000.0;
+    for (const Entry &e : sorted)
+        file << ',' << (e.end - e.start) * 1000.0;
+    file << '\n';
+    return static_cast<bool>(file);
+}
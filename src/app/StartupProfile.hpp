@@ -0,0 +1,60 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Cold-start timing: named phases (main thread and asset loader), measured from the
+// construction of the profile (start of App). Printed once the first real frame is
+// shown, and appended as one CSV row per launch to track startup time across builds.
+class StartupProfile
+{
+public:
+    struct Entry
+    {
+        std::string name;
+        double start = 0.0; // seconds since the profile was created
+        double end = 0.0;
+    };
+
+    // Records [construction, destruction] as one phase
+    class Phase
+    {
+    public:
+        Phase(StartupProfile &profile, const char *name) : profile(profile), name(name), start(profile.now()) {}
+        ~Phase() { profile.add(name, start, profile.now()); }
+
+        Phase(const Phase &) = delete;
+        Phase &operator=(const Phase &) = delete;
+
+    private:
+        StartupProfile &profile;
+        const char *name;
+        double start;
+    };
+
+    StartupProfile() : origin(std::chrono::steady_clock::now()) {}
+
+    double now() const;
+
+    // Thread-safe: the asset loader records its phases from its own thread
+    void add(const std::string &name, double start, double end);
+
+    // Marks the end of startup (first frame of the first real scene); only the first call counts
+    void finish();
+    bool isFinished() const;
+
+    void print(std::ostream &os) const;
+
+    // Appends "timestamp,total_ms,<phase>_ms..." (header written when the file is new)
+    bool appendCsv(const std::string &path) const;
+
+private:
+    std::chrono::steady_clock::time_point origin;
+
+    mutable std::mutex mutex;
+    std::vector<Entry> entries;
+    double total = 0.0; // 0 until finish()
+};
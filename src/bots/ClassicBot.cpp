@@ -0,0 +1,63 @@
+#include "ClassicBot.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr float DEAD_ZONE = 6.0f; // px around the aim point where the paddle stays still
+    constexpr std::size_t MAX_HISTORY = 256;
+} // namespace
+
+ClassicBot::ClassicBot(std::uint32_t seed)
+    : rng(seed)
+{
+    reactionSeconds = std::uniform_real_distribution<float>(0.02f, 0.20f)(rng);
+    placementError = std::uniform_real_distribution<float>(4.0f, 30.0f)(rng);
+    launchDelay = std::uniform_real_distribution<float>(0.1f, 1.0f)(rng);
+    seenBallX.assign(MAX_HISTORY, 0.0f);
+}
+
+float ClassicBot::laggedBallX(float current, float dt)
+{
+    seenBallX[seenHead] = current;
+    seenHead = (seenHead + 1) % seenBallX.size();
+    seenCount = std::min(seenCount + 1, seenBallX.size());
+
+    const std::size_t lag = std::min(static_cast<std::size_t>(reactionSeconds / dt), seenCount - 1);
+    return seenBallX[(seenHead + seenBallX.size() - 1 - lag) % seenBallX.size()];
+}
+
+ClassicInput ClassicBot::think(const ClassicSimulation &sim, float dt)
+{
+    ClassicInput in;
+
+    const Ball &ball = sim.getBall();
+    const float ballX = laggedBallX(ball.getPosition().x, dt);
+
+    if (!sim.isBallLaunched())
+    {
+        waited += dt;
+        if (waited >= launchDelay)
+        {
+            in.launch = true;
+            waited = 0.0f;
+        }
+        return in;
+    }
+
+    // New aim point each time the ball starts coming down
+    const bool rising = ball.getVelocity().y < 0.0f;
+    if (ballRising && !rising)
+    {
+        const float maxOffset = ClassicSimulation::PADDLE_W * 0.5f - 4.0f;
+        offset = std::clamp(std::normal_distribution<float>(0.0f, placementError)(rng), -maxOffset, maxOffset);
+    }
+    ballRising = rising;
+
+    const float paddleCenter = sim.getPaddle().getPosition().x + ClassicSimulation::PADDLE_W * 0.5f;
+    const float target = ballX - offset;
+    in.moveLeft = target < paddleCenter - DEAD_ZONE;
+    in.moveRight = target > paddleCenter + DEAD_ZONE;
+    return in;
+}
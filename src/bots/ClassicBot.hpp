@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../game/ClassicSimulation.hpp"
+
+/**
+ * @brief Joueur automatique du mode classique (équilibrage, démonstrations)
+ *
+ * Suit la balle avec un temps de réaction et une erreur de placement tirés au
+ * hasard pour chaque partie : avec des graines différentes, les parties diffèrent
+ * comme celles de joueurs de niveaux différents. À graine égale, le bot est
+ * déterministe.
+ */
+class ClassicBot
+{
+public:
+    explicit ClassicBot(std::uint32_t seed);
+
+    /**
+     * @brief Entrées du prochain pas, d'après l'état courant
+     */
+    ClassicInput think(const ClassicSimulation &sim, float dt);
+
+    float getReactionSeconds() const { return reactionSeconds; }
+
+private:
+    std::mt19937 rng;
+
+    // Skill, drawn once per game
+    float reactionSeconds = 0.1f; // the bot sees the ball where it was this long ago
+    float placementError = 10.0f; // px, std dev of where the ball should meet the paddle
+    float launchDelay = 0.5f;     // seconds before launching a ball
+
+    // Recent ball x positions (ring buffer), read with the reaction delay
+    std::vector<float> seenBallX;
+    std::size_t seenHead = 0;
+    std::size_t seenCount = 0;
+
+    float offset = 0.0f; // aim point on the paddle for the current approach
+    bool ballRising = true;
+    float waited = 0.0f;
+
+    float laggedBallX(float current, float dt);
+};
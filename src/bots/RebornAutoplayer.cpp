@@ -0,0 +1,149 @@
+#include "RebornAutoplayer.hpp"
+
+#include "../core/Trace.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace
+{
+    // Firing arc allowed by Cannon::pointAt (upwards, ~7 degrees off horizontal)
+    constexpr float PI = 3.14159265358979323846f;
+    constexpr float ARC_MARGIN = 0.12f;
+    constexpr float MIN_ANGLE = -PI + ARC_MARGIN;
+    constexpr float MAX_ANGLE = -ARC_MARGIN;
+
+    constexpr float AIM_DISTANCE = 200.0f;
+
+    // Rollout value
+    constexpr float HP_VALUE = 10.0f;       // per brick hit point removed
+    constexpr float DESTROY_VALUE = 5.0f;   // per brick destroyed
+    constexpr float AMMO_COST = 6.0f;       // per unit of budget spent
+    constexpr float DANGER_MARGIN = 120.0f; // px above the danger line that start to hurt
+    constexpr float DANGER_COST = 2.0f;     // per px inside that margin
+    constexpr float WIN_VALUE = 10000.0f;
+    constexpr float LOSE_COST = 10000.0f;
+
+    const Projectile::ShotType SHOT_TYPES[] = {
+        Projectile::ShotType::Normal,
+        Projectile::ShotType::Piercing,
+        Projectile::ShotType::Explosive,
+    };
+
+    int hitPointsLeft(const BrickField &bricks)
+    {
+        int total = 0;
+        for (std::size_t i = 0; i < bricks.size(); i++)
+            total += bricks.alive[i] ? bricks.hp[i] : 0;
+        return total;
+    }
+
+    Vec2 aimPoint(const RebornSimulation &sim, float angle)
+    {
+        const Vec2 c = sim.getCannon().getPosition();
+        return Vec2(c.x + AIM_DISTANCE * std::cos(angle), c.y + AIM_DISTANCE * std::sin(angle));
+    }
+} // namespace
+
+RebornAutoplayer::RebornAutoplayer(JobSystem &jobs, std::uint32_t seed)
+    : RebornAutoplayer(jobs, Config(), seed)
+{
+}
+
+RebornAutoplayer::RebornAutoplayer(JobSystem &jobs, const Config &config, std::uint32_t seed)
+    : jobs(jobs),
+      config(config),
+      rng(seed)
+{
+}
+
+RebornInput RebornAutoplayer::think(const RebornSimulation &sim, float dt)
+{
+    planAge += dt;
+    if (!hasPlan || planAge >= config.decisionSeconds)
+        search(sim);
+
+    RebornInput in;
+    in.aim = aimPoint(sim, plan.angle);
+    in.fireHeld = true;
+    in.selectShot = sim.getCurrentShot() != plan.shot;
+    in.shot = plan.shot;
+    return in;
+}
+
+void RebornAutoplayer::search(const RebornSimulation &sim)
+{
+    TRACE_SCOPE("RebornAutoplayer::search");
+    const auto t0 = std::chrono::steady_clock::now();
+
+    // Stratified angles (one random offset per search), plus the current plan for stability
+    candidates.clear();
+    const float offset = std::uniform_real_distribution<float>(0.0f, 1.0f)(rng);
+    const float arc = MAX_ANGLE - MIN_ANGLE;
+    for (int i = 0; i <= config.angles; i++)
+    {
+        const float angle = (i < config.angles) ? MIN_ANGLE + arc * (i + offset) / config.angles : plan.angle;
+        if (i == config.angles && !hasPlan)
+            break;
+        for (const Projectile::ShotType shot : SHOT_TYPES)
+            candidates.push_back(Candidate{angle, shot, 0.0f});
+    }
+
+    // One working copy per thread, made the first time that thread runs a rollout; after
+    // that, copying reuses its storage
+    forks.resize(jobs.maxThreads());
+
+    jobs.parallelFor(candidates.size(), 1, [&](std::size_t begin, std::size_t end, unsigned thread)
+                     {
+                         std::optional<RebornSimulation> &fork = forks[thread];
+                         for (std::size_t i = begin; i < end; i++)
+                         {
+                             if (fork)
+                                 *fork = sim;
+                             else
+                                 fork.emplace(sim);
+                             candidates[i].value = rollout(*fork, candidates[i]);
+                         } });
+
+    // Best value, first candidate on ties: same choice whatever the thread count
+    const auto best = std::max_element(candidates.begin(), candidates.end(), [](const Candidate &a, const Candidate &b)
+                                       { return a.value < b.value; });
+    plan = *best;
+    planAge = 0.0f;
+    hasPlan = true;
+
+    lastSearchSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    maxSearchSeconds = std::max(maxSearchSeconds, lastSearchSeconds);
+}
+
+float RebornAutoplayer::rollout(RebornSimulation &fork, const Candidate &c) const
+{
+    const int hpBefore = hitPointsLeft(fork.getBricks());
+    const int aliveBefore = fork.getBricks().getAliveCount();
+    const int usedBefore = fork.getUsed();
+
+    RebornInput in;
+    in.aim = aimPoint(fork, c.angle);
+    in.fireHeld = true;
+    in.selectShot = true;
+    in.shot = c.shot;
+
+    const int steps = std::max(1, static_cast<int>(config.horizonSeconds / config.rolloutStep));
+    for (int s = 0; s < steps && fork.getState() == RebornSimulation::State::Playing; s++)
+        fork.step(config.rolloutStep, in);
+
+    const BrickField &bricks = fork.getBricks();
+    float value = HP_VALUE * (hpBefore - hitPointsLeft(bricks)) +
+                  DESTROY_VALUE * (aliveBefore - bricks.getAliveCount()) -
+                  AMMO_COST * (fork.getUsed() - usedBefore);
+
+    const float margin = fork.getDangerLineY() - fork.lowestBrickBottom();
+    value -= DANGER_COST * std::max(0.0f, DANGER_MARGIN - margin);
+
+    if (fork.getState() == RebornSimulation::State::Win)
+        value += WIN_VALUE;
+    else if (fork.getState() == RebornSimulation::State::Lose)
+        value -= LOSE_COST;
+    return value;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "../core/JobSystem.hpp"
+#include "../game_reborn/RebornSimulation.hpp"
+
+/**
+ * @brief Joueur automatique Reborn par recherche Monte-Carlo (démonstrations, tests d'endurance)
+ *
+ * À chaque décision, l'état courant est copié (RebornSimulation est une valeur :
+ * la copie est la bifurcation) et des couples (angle, type de tir) candidats sont
+ * joués en avance sur un horizon court, en parallèle sur un JobSystem. Le meilleur
+ * candidat (points de vie de briques retirés, munitions dépensées, marge avant la
+ * ligne de danger) est gardé jusqu'à la décision suivante.
+ *
+ * Les copies de travail sont conservées par thread : après la première décision,
+ * bifurquer ne fait plus d'allocation. Le résultat ne dépend pas du nombre de threads.
+ */
+class RebornAutoplayer
+{
+public:
+    struct Config
+    {
+        int angles = 16;                     // candidate directions, spread over the firing arc
+        float horizonSeconds = 2.0f;         // look-ahead of each rollout
+        float rolloutStep = 1.0f / 60.0f;    // coarser than the game step: cheaper, close enough
+        float decisionSeconds = 0.25f;       // time a chosen plan is held
+    };
+
+    RebornAutoplayer(JobSystem &jobs, std::uint32_t seed = 1);
+    RebornAutoplayer(JobSystem &jobs, const Config &config, std::uint32_t seed = 1);
+
+    /**
+     * @brief Entrées du prochain pas ; relance une recherche quand le plan courant expire
+     */
+    RebornInput think(const RebornSimulation &sim, float dt);
+
+    /**
+     * @brief Durée de la dernière recherche (temps réel, secondes)
+     */
+    double getLastSearchSeconds() const { return lastSearchSeconds; }
+    double getMaxSearchSeconds() const { return maxSearchSeconds; }
+    int getCandidateCount() const { return static_cast<int>(candidates.size()); }
+
+private:
+    struct Candidate
+    {
+        float angle = 0.0f;
+        Projectile::ShotType shot = Projectile::ShotType::Normal;
+        float value = 0.0f;
+    };
+
+    JobSystem &jobs;
+    Config config;
+    std::mt19937 rng;
+
+    std::vector<Candidate> candidates;
+    std::vector<std::optional<RebornSimulation>> forks; // one per JobSystem thread, made on first use
+
+    Candidate plan;
+    float planAge = 0.0f;
+    bool hasPlan = false;
+
+    double lastSearchSeconds = 0.0;
+    double maxSearchSeconds = 0.0;
+
+    void search(const RebornSimulation &sim);
+    float rollout(RebornSimulation &fork, const Candidate &c) const;
+};
@@ -0,0 +1,83 @@
+#include "RebornBot.hpp"
+
+#include <cmath>
+
+namespace
+{
+    constexpr float AIM_DISTANCE = 200.0f; // aim point along the chosen direction
+} // namespace
+
+RebornBot::RebornBot(std::uint32_t seed)
+    : rng(seed)
+{
+    aimErrorRadians = std::uniform_real_distribution<float>(0.005f, 0.08f)(rng);
+    lowestFirst = std::uniform_real_distribution<float>(0.3f, 1.0f)(rng);
+    specialShots = std::uniform_real_distribution<float>(0.0f, 0.6f)(rng);
+    retargetSeconds = std::uniform_real_distribution<float>(0.3f, 1.5f)(rng);
+}
+
+void RebornBot::pickTarget(const RebornSimulation &sim)
+{
+    const BrickField &bricks = sim.getBricks();
+    target = -1;
+    targetAge = 0.0f;
+    if (bricks.allDestroyed())
+        return;
+
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+    if (chance(rng) < lowestFirst)
+    {
+        float lowest = -1.0f;
+        for (std::size_t i = 0; i < bricks.size(); i++)
+        {
+            if (bricks.alive[i] && bricks.y[i] + bricks.h[i] > lowest)
+            {
+                lowest = bricks.y[i] + bricks.h[i];
+                target = static_cast<int>(i);
+            }
+        }
+    }
+    else
+    {
+        // k-th live brick
+        int k = std::uniform_int_distribution<int>(0, bricks.getAliveCount() - 1)(rng);
+        for (std::size_t i = 0; i < bricks.size() && target < 0; i++)
+        {
+            if (bricks.alive[i] && k-- == 0)
+                target = static_cast<int>(i);
+        }
+    }
+
+    aimError = std::normal_distribution<float>(0.0f, aimErrorRadians)(rng);
+
+    // Tough bricks may get a special shot, if the budget allows it
+    const int ammoLeft = sim.getBudget() - sim.getUsed();
+    shot = Projectile::ShotType::Normal;
+    if (target >= 0 && bricks.hp[target] >= 2 && ammoLeft > 10 && chance(rng) < specialShots)
+        shot = (chance(rng) < 0.5f) ? Projectile::ShotType::Piercing : Projectile::ShotType::Explosive;
+}
+
+RebornInput RebornBot::think(const RebornSimulation &sim, float dt)
+{
+    targetAge += dt;
+    if (target < 0 || !sim.getBricks().alive[target] || targetAge >= retargetSeconds)
+        pickTarget(sim);
+
+    RebornInput in;
+    in.fireHeld = target >= 0;
+    in.selectShot = sim.getCurrentShot() != shot;
+    in.shot = shot;
+
+    const Vec2 cannon = sim.getCannon().getPosition();
+    Vec2 aim(cannon.x, 0.0f);
+    if (target >= 0)
+    {
+        const BrickField &bricks = sim.getBricks();
+        const float dx = bricks.x[target] + bricks.w[target] * 0.5f - cannon.x;
+        const float dy = bricks.y[target] + bricks.h[target] * 0.5f - cannon.y;
+        const float angle = std::atan2(dy, dx) + aimError;
+        aim = Vec2(cannon.x + AIM_DISTANCE * std::cos(angle), cannon.y + AIM_DISTANCE * std::sin(angle));
+    }
+    in.aim = aim;
+    return in;
+}
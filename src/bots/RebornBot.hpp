@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+
+#include "../game_reborn/RebornSimulation.hpp"
+
+/**
+ * @brief Joueur automatique scripté du mode Reborn (équilibrage)
+ *
+ * Vise une brique (la plus basse en priorité, sinon une brique au hasard) avec une
+ * erreur angulaire, tire en continu et choisit le type de tir selon les points de
+ * vie de la cible. Précision, priorité et goût pour les tirs spéciaux sont tirés
+ * au hasard pour chaque partie ; à graine égale, le bot est déterministe.
+ */
+class RebornBot
+{
+public:
+    explicit RebornBot(std::uint32_t seed);
+
+    /**
+     * @brief Entrées du prochain pas, d'après l'état courant
+     */
+    RebornInput think(const RebornSimulation &sim, float dt);
+
+private:
+    std::mt19937 rng;
+
+    // Skill, drawn once per game
+    float aimErrorRadians = 0.02f;
+    float lowestFirst = 0.7f;    // chance to pick the lowest brick rather than a random one
+    float specialShots = 0.3f;   // chance to use a piercing/explosive shot on a tough brick
+    float retargetSeconds = 0.6f;
+
+    int target = -1;
+    float targetAge = 0.0f;
+    float aimError = 0.0f; // radians, drawn per target
+    Projectile::ShotType shot = Projectile::ShotType::Normal;
+
+    void pickTarget(const RebornSimulation &sim);
+};
@@ -0,0 +1,139 @@
+#include "BrickField.hpp"
+
+#include "StateHash.hpp"
+
+#include <algorithm>
+
+void BrickField::clear()
+{
+    x.clear();
+    y.clear();
+    w.clear();
+    h.clear();
+    hp.clear();
+    maxHP.clear();
+    alive.clear();
+    points.clear();
+    color.clear();
+    aliveCount = 0;
+
+    layoutVersion++;
+    changeLog.clear();
+    translationY = 0.0f;
+}
+
+void BrickField::reserve(std::size_t n)
+{
+    x.reserve(n);
+    y.reserve(n);
+    w.reserve(n);
+    h.reserve(n);
+    hp.reserve(n);
+    maxHP.reserve(n);
+    alive.reserve(n);
+    points.reserve(n);
+    color.reserve(n);
+}
+
+int BrickField::add(float bx, float by, float bw, float bh, int hitPoints, const Color &col, int pts)
+{
+    x.push_back(bx);
+    y.push_back(by);
+    w.push_back(bw);
+    h.push_back(bh);
+    hp.push_back(hitPoints);
+    maxHP.push_back(hitPoints);
+    alive.push_back(1);
+    points.push_back(pts);
+    color.push_back(col);
+    aliveCount++;
+
+    layoutVersion++;
+    changeLog.clear();
+    translationY = 0.0f;
+    return static_cast<int>(x.size()) - 1;
+}
+
+void BrickField::respawn(std::size_t i, float bx, float by, float bw, float bh, int hitPoints, const Color &col, int pts)
+{
+    if (!alive[i])
+        aliveCount++;
+
+    x[i] = bx;
+    y[i] = by;
+    w[i] = bw;
+    h[i] = bh;
+    hp[i] = hitPoints;
+    maxHP[i] = hitPoints;
+    alive[i] = 1;
+    points[i] = pts;
+    color[i] = col;
+
+    layoutVersion++;
+    changeLog.clear();
+    translationY = 0.0f;
+}
+
+bool BrickField::damage(std::size_t i, int amount)
+{
+    if (!alive[i])
+        return false;
+
+    hp[i] -= amount;
+    markChanged(i);
+    if (hp[i] > 0)
+        return false;
+
+    hp[i] = 0;
+    alive[i] = 0;
+    aliveCount--;
+    return true;
+}
+
+void BrickField::translateY(float dy)
+{
+    // Branch-free: destroyed bricks move too, nobody reads their position
+    float *py = y.data();
+    const std::size_t n = y.size();
+    for (std::size_t i = 0; i < n; i++)
+        py[i] += dy;
+    translationY += dy;
+}
+
+float BrickField::lowestAliveBottom() const
+{
+    float maxBottom = 0.0f;
+    const std::size_t n = y.size();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        if (alive[i])
+            maxBottom = std::max(maxBottom, y[i] + h[i]);
+    }
+    return maxBottom;
+}
+
+std::vector<AABB> BrickField::boxes() const
+{
+    std::vector<AABB> out;
+    boxes(out);
+    return out;
+}
+
+void BrickField::boxes(std::vector<AABB> &out) const
+{
+    out.resize(size());
+    for (std::size_t i = 0; i < size(); i++)
+        out[i] = getAABB(i);
+}
+
+void BrickField::hashInto(StateHash &hash) const
+{
+    hash.add(static_cast<std::uint64_t>(size()));
+    for (std::size_t i = 0; i < size(); i++)
+    {
+        hash.add(x[i]);
+        hash.add(y[i]);
+        hash.add(hp[i]);
+        hash.add(alive[i] != 0);
+    }
+}
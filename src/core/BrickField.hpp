@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "AABB.hpp"
+#include "Color.hpp"
+
+class StateHash;
+
+/**
+ * @brief Champ de briques stocké en structure de tableaux (SoA)
+ *
+ * Une brique n'est qu'un rectangle statique avec des points de vie : au lieu d'un
+ * std::vector<Brick> (GameObject complet + vtable par brique), chaque attribut vit
+ * dans son propre tableau contigu. Les boucles chaudes (descente, ligne de danger,
+ * victoire, collisions) ne lisent que les tableaux dont elles ont besoin.
+ *
+ * L'indice d'une brique est stable pendant toute la partie (les briques détruites
+ * restent en place avec alive = 0).
+ */
+struct BrickField
+{
+    // Géométrie (coin haut-gauche + taille)
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> w;
+    std::vector<float> h;
+
+    // État
+    std::vector<int> hp;
+    std::vector<int> maxHP;
+    std::vector<std::uint8_t> alive;
+
+    // Données froides (score, rendu)
+    std::vector<int> points;
+    std::vector<Color> color;
+
+    void clear();
+    void reserve(std::size_t n);
+
+    /**
+     * @brief Ajoute une brique et retourne son indice
+     */
+    int add(float bx, float by, float bw, float bh, int hitPoints, const Color &col, int pts = 0);
+
+    /**
+     * @brief Réutilise l'emplacement d'une brique détruite pour une nouvelle brique
+     *
+     * Le nombre d'emplacements ne change pas (flux infini de briques à mémoire constante).
+     * Comme add(), c'est un changement de disposition.
+     */
+    void respawn(std::size_t i, float bx, float by, float bw, float bh, int hitPoints, const Color &col, int pts = 0);
+
+    std::size_t size() const { return x.size(); }
+    int getAliveCount() const { return aliveCount; }
+    bool allDestroyed() const { return aliveCount == 0; }
+
+    AABB getAABB(std::size_t i) const { return AABB{x[i], y[i], x[i] + w[i], y[i] + h[i]}; }
+
+    /**
+     * @brief Inflige des dégâts ; retourne true si la brique vient d'être détruite
+     */
+    bool damage(std::size_t i, int amount = 1);
+
+    /**
+     * @brief Déplace tout le champ verticalement (briques détruites comprises)
+     */
+    void translateY(float dy);
+
+    /**
+     * @brief Bas de la brique vivante la plus basse (0 si aucune)
+     */
+    float lowestAliveBottom() const;
+
+    /**
+     * @brief Boîtes de toutes les briques (pour reconstruire une SpatialGrid)
+     */
+    std::vector<AABB> boxes() const;
+    void boxes(std::vector<AABB> &out) const; // sans allocation une fois out dimensionné
+
+    /**
+     * @brief Ajoute l'état de jeu des briques (position, points de vie, vivante) à une empreinte
+     */
+    void hashInto(StateHash &hash) const;
+
+    /**
+     * @brief Signale un changement d'apparence (ex : couleur) d'une brique
+     *
+     * damage() le fait déjà ; à appeler pour les autres modifications visibles.
+     */
+    void markChanged(std::size_t i) { changeLog.push_back(static_cast<int>(i)); }
+
+    /**
+     * @brief Version de la disposition : change à chaque clear() / add() / respawn()
+     *
+     * Un cache de rendu (render/BrickLayer) se reconstruit entièrement quand elle change,
+     * et sinon ne redessine que les briques du journal des changements.
+     */
+    std::uint32_t getLayoutVersion() const { return layoutVersion; }
+
+    /**
+     * @brief Indices des briques modifiées depuis le dernier changement de disposition
+     */
+    const std::vector<int> &getChangeLog() const { return changeLog; }
+
+    /**
+     * @brief Translation verticale cumulée (translateY) depuis le dernier changement de disposition
+     */
+    float getTranslationY() const { return translationY; }
+
+private:
+    int aliveCount = 0;
+
+    std::uint32_t layoutVersion = 0;
+    std::vector<int> changeLog; // vidé à chaque changement de disposition
+    float translationY = 0.0f;
+};
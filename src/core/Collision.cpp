@@ -0,0 +1,195 @@
+#include "Collision.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Collision
+{
+
+    namespace
+    {
+        float clampf(float v, float lo, float hi)
+        {
+            return std::max(lo, std::min(v, hi));
+        }
+
+        // Earliest t in [0, 1] where |start + motion * t - corner| == radius
+        bool sweepCircleCorner(const Vec2 &start, const Vec2 &motion, float radius, const Vec2 &corner, float &outT)
+        {
+            const Vec2 m = start - corner;
+            const float a = motion.x * motion.x + motion.y * motion.y;
+            const float b = m.x * motion.x + m.y * motion.y;
+            const float c = m.x * m.x + m.y * m.y - radius * radius;
+
+            // Moving away from the corner, or not moving
+            if (a <= 0.0f || b > 0.0f)
+                return false;
+
+            const float disc = b * b - a * c;
+            if (disc < 0.0f)
+                return false;
+
+            const float t = (-b - std::sqrt(disc)) / a;
+            if (t < 0.0f || t > 1.0f)
+                return false;
+
+            outT = t;
+            return true;
+        }
+    } // namespace
+
+    bool circleRectCollisionNormal(const Vec2 &c, float r, const AABB &box, Vec2 &outNormal, float &outPenetration)
+    {
+        const float closestX = clampf(c.x, box.left, box.right);
+        const float closestY = clampf(c.y, box.top, box.bottom);
+
+        float dx = c.x - closestX;
+        float dy = c.y - closestY;
+        const float d2 = dx * dx + dy * dy;
+
+        // If outside / touching but not intersecting, no collision
+        if (d2 >= r * r)
+            return false;
+
+        // If the circle center is inside the rectangle (dx=dy=0), choose the nearest side.
+        if (dx == 0.0f && dy == 0.0f)
+        {
+            const float distLeft = c.x - box.left;
+            const float distRight = box.right - c.x;
+            const float distTop = c.y - box.top;
+            const float distBottom = box.bottom - c.y;
+
+            const float minDist = std::min(std::min(distLeft, distRight), std::min(distTop, distBottom));
+            if (minDist == distLeft)
+                outNormal = Vec2(-1.0f, 0.0f);
+            else if (minDist == distRight)
+                outNormal = Vec2(1.0f, 0.0f);
+            else if (minDist == distTop)
+                outNormal = Vec2(0.0f, -1.0f);
+            else
+                outNormal = Vec2(0.0f, 1.0f);
+
+            outPenetration = r + 1.0f;
+            return true;
+        }
+
+        const float d = std::sqrt(d2);
+        outNormal = Vec2(dx / d, dy / d);
+        outPenetration = r - d;
+        return true;
+    }
+
+    bool sweepCircleAABB(const Vec2 &start, const Vec2 &motion, float radius, const AABB &box, float &outT, Vec2 &outNormal)
+    {
+        // Slab test of the center segment against the box expanded by the radius
+        const float left = box.left - radius;
+        const float right = box.right + radius;
+        const float top = box.top - radius;
+        const float bottom = box.bottom + radius;
+
+        // Already overlapping the box itself: not an "entering" contact
+        const float dx = start.x - clampf(start.x, box.left, box.right);
+        const float dy = start.y - clampf(start.y, box.top, box.bottom);
+        if (dx * dx + dy * dy < radius * radius)
+            return false;
+
+        // Inside the expanded box without touching: a corner square, where only the
+        // rounded corner can be hit
+        if (start.x > left && start.x < right && start.y > top && start.y < bottom)
+        {
+            const Vec2 corner(start.x < box.left ? box.left : box.right,
+                              start.y < box.top ? box.top : box.bottom);
+            float t = 0.0f;
+            if (!sweepCircleCorner(start, motion, radius, corner, t))
+                return false;
+
+            outT = t;
+            outNormal = (start + motion * t - corner) / radius;
+            return true;
+        }
+
+        constexpr float inf = std::numeric_limits<float>::infinity();
+        float tEnter = -inf;
+        float tExit = inf;
+        Vec2 normal;
+
+        if (motion.x != 0.0f)
+        {
+            const float inv = 1.0f / motion.x;
+            float t0 = (left - start.x) * inv;
+            float t1 = (right - start.x) * inv;
+            Vec2 n(-1.0f, 0.0f);
+            if (t0 > t1)
+            {
+                std::swap(t0, t1);
+                n = Vec2(1.0f, 0.0f);
+            }
+            if (t0 > tEnter)
+            {
+                tEnter = t0;
+                normal = n;
+            }
+            tExit = std::min(tExit, t1);
+        }
+        else if (start.x <= left || start.x >= right)
+        {
+            return false;
+        }
+
+        if (motion.y != 0.0f)
+        {
+            const float inv = 1.0f / motion.y;
+            float t0 = (top - start.y) * inv;
+            float t1 = (bottom - start.y) * inv;
+            Vec2 n(0.0f, -1.0f);
+            if (t0 > t1)
+            {
+                std::swap(t0, t1);
+                n = Vec2(0.0f, 1.0f);
+            }
+            if (t0 > tEnter)
+            {
+                tEnter = t0;
+                normal = n;
+            }
+            tExit = std::min(tExit, t1);
+        }
+        else if (start.y <= top || start.y >= bottom)
+        {
+            return false;
+        }
+
+        if (tEnter > tExit || tEnter < 0.0f || tEnter > 1.0f)
+            return false;
+
+        // Entry point outside the box on both axes: the real shape there is a rounded corner
+        const Vec2 hit = start + motion * tEnter;
+        const bool outX = hit.x < box.left || hit.x > box.right;
+        const bool outY = hit.y < box.top || hit.y > box.bottom;
+        if (outX && outY)
+        {
+            const Vec2 corner(hit.x < box.left ? box.left : box.right,
+                              hit.y < box.top ? box.top : box.bottom);
+            float t = 0.0f;
+            if (!sweepCircleCorner(start, motion, radius, corner, t))
+                return false;
+
+            const Vec2 c = start + motion * t;
+            outT = t;
+            outNormal = (c - corner) / radius;
+            return true;
+        }
+
+        outT = tEnter;
+        outNormal = normal;
+        return true;
+    }
+
+    Vec2 reflect(const Vec2 &v, const Vec2 &n)
+    {
+        const float dot = v.x * n.x + v.y * n.y;
+        return Vec2(v.x - 2.0f * dot * n.x, v.y - 2.0f * dot * n.y);
+    }
+
+} // namespace Collision
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "AABB.hpp"
+#include "Vec2.hpp"
+
+/**
+ * @brief Tests de collision cercle / rectangle utilisés par les simulations
+ */
+namespace Collision
+{
+    /**
+     * @brief Contact statique cercle-AABB (le cercle chevauche déjà la boîte)
+     * @param center Centre du cercle
+     * @param radius Rayon du cercle
+     * @param box Rectangle
+     * @param outNormal Normale de sortie (de la boîte vers le cercle)
+     * @param outPenetration Profondeur de pénétration
+     * @return true si chevauchement
+     */
+    bool circleRectCollisionNormal(const Vec2 &center, float radius, const AABB &box, Vec2 &outNormal, float &outPenetration);
+
+    /**
+     * @brief Test continu : cercle se déplaçant de start à start + motion contre un AABB
+     *
+     * Calcule le premier instant de contact (time of impact) sur le segment,
+     * en intersectant la trajectoire du centre avec la boîte élargie du rayon
+     * (faces + coins arrondis). Un cercle qui chevauche déjà la boîte au départ
+     * n'est pas signalé ici (voir circleRectCollisionNormal).
+     *
+     * @param outT Instant de contact dans [0, 1] (fraction du déplacement)
+     * @param outNormal Normale de la face/du coin touché
+     * @return true si contact pendant le déplacement
+     */
+    bool sweepCircleAABB(const Vec2 &start, const Vec2 &motion, float radius, const AABB &box, float &outT, Vec2 &outNormal);
+
+    /**
+     * @brief Réflexion d'une vitesse sur une normale unitaire
+     */
+    Vec2 reflect(const Vec2 &v, const Vec2 &n);
+} // namespace Collision
@@ -0,0 +1,281 @@
+#include "CollisionBatch.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CASSEBRIQUES_BATCH_SSE2 1
+#endif
+
+// AVX2 kernel: its own translation unit (CollisionBatchAvx2.cpp), picked at run time by CPUID
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define CASSEBRIQUES_BATCH_AVX2 1
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+#endif
+
+namespace Collision
+{
+
+    namespace
+    {
+        // One box, same rules as circleRectCollisionNormal
+        bool circleRectOne(float cx, float cy, float r, float bx, float by, float bw, float bh,
+                           float &nx, float &ny, float &pen)
+        {
+            const float left = bx;
+            const float top = by;
+            const float right = bx + bw;
+            const float bottom = by + bh;
+
+            const float closestX = std::max(left, std::min(cx, right));
+            const float closestY = std::max(top, std::min(cy, bottom));
+            const float dx = cx - closestX;
+            const float dy = cy - closestY;
+            const float d2 = dx * dx + dy * dy;
+
+            if (d2 >= r * r)
+                return false;
+
+            if (dx == 0.0f && dy == 0.0f)
+            {
+                // Center inside: nearest side
+                const float distLeft = cx - left;
+                const float distRight = right - cx;
+                const float distTop = cy - top;
+                const float distBottom = bottom - cy;
+                const float minDist = std::min(std::min(distLeft, distRight), std::min(distTop, distBottom));
+
+                nx = 0.0f;
+                ny = 0.0f;
+                if (minDist == distLeft)
+                    nx = -1.0f;
+                else if (minDist == distRight)
+                    nx = 1.0f;
+                else if (minDist == distTop)
+                    ny = -1.0f;
+                else
+                    ny = 1.0f;
+                pen = r + 1.0f;
+                return true;
+            }
+
+            const float d = std::sqrt(d2);
+            nx = dx / d;
+            ny = dy / d;
+            pen = r - d;
+            return true;
+        }
+    } // namespace
+
+    int circleRectBatchScalar(float cx, float cy, float radius,
+                              const float *x, const float *y, const float *w, const float *h, std::size_t count,
+                              std::uint8_t *outHit, float *outNx, float *outNy, float *outPen)
+    {
+        int hits = 0;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const bool hit = circleRectOne(cx, cy, radius, x[i], y[i], w[i], h[i], outNx[i], outNy[i], outPen[i]);
+            outHit[i] = hit ? 1 : 0;
+            hits += hit ? 1 : 0;
+        }
+        return hits;
+    }
+
+#if defined(CASSEBRIQUES_BATCH_SSE2)
+
+    namespace
+    {
+        // SSE2 has no blendv: (mask & b) | (~mask & a)
+        inline __m128 select(__m128 a, __m128 b, __m128 mask)
+        {
+            return _mm_or_ps(_mm_and_ps(mask, b), _mm_andnot_ps(mask, a));
+        }
+    } // namespace
+
+    int circleRectBatchSse2(float cx, float cy, float radius,
+                            const float *x, const float *y, const float *w, const float *h, std::size_t count,
+                            std::uint8_t *outHit, float *outNx, float *outNy, float *outPen)
+    {
+        const __m128 vcx = _mm_set1_ps(cx);
+        const __m128 vcy = _mm_set1_ps(cy);
+        const __m128 vr = _mm_set1_ps(radius);
+        const __m128 vr2 = _mm_set1_ps(radius * radius);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 minusOne = _mm_set1_ps(-1.0f);
+        const __m128 allOnes = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+        int hits = 0;
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 left = _mm_loadu_ps(x + i);
+            const __m128 top = _mm_loadu_ps(y + i);
+            const __m128 right = _mm_add_ps(left, _mm_loadu_ps(w + i));
+            const __m128 bottom = _mm_add_ps(top, _mm_loadu_ps(h + i));
+
+            const __m128 dx = _mm_sub_ps(vcx, _mm_max_ps(left, _mm_min_ps(vcx, right)));
+            const __m128 dy = _mm_sub_ps(vcy, _mm_max_ps(top, _mm_min_ps(vcy, bottom)));
+            const __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+
+            const __m128 hitMask = _mm_cmplt_ps(d2, vr2);
+            const int mask = _mm_movemask_ps(hitMask);
+            if (mask == 0)
+            {
+                std::fill(outHit + i, outHit + i + 4, std::uint8_t(0));
+                continue;
+            }
+
+            // Outside: normal = (dx, dy) / d
+            const __m128 d = _mm_sqrt_ps(d2);
+            __m128 nx = _mm_div_ps(dx, d);
+            __m128 ny = _mm_div_ps(dy, d);
+            __m128 pen = _mm_sub_ps(vr, d);
+
+            // Center inside the box: nearest side (left, right, top, bottom priority)
+            const __m128 inside = _mm_and_ps(_mm_cmpeq_ps(dx, zero), _mm_cmpeq_ps(dy, zero));
+            if (_mm_movemask_ps(inside) != 0)
+            {
+                const __m128 distLeft = _mm_sub_ps(vcx, left);
+                const __m128 distRight = _mm_sub_ps(right, vcx);
+                const __m128 distTop = _mm_sub_ps(vcy, top);
+                const __m128 distBottom = _mm_sub_ps(bottom, vcy);
+                const __m128 minDist = _mm_min_ps(_mm_min_ps(distLeft, distRight), _mm_min_ps(distTop, distBottom));
+
+                const __m128 selLeft = _mm_cmpeq_ps(distLeft, minDist);
+                const __m128 selRight = _mm_andnot_ps(selLeft, _mm_cmpeq_ps(distRight, minDist));
+                const __m128 selX = _mm_or_ps(selLeft, selRight);
+                const __m128 selTop = _mm_andnot_ps(selX, _mm_cmpeq_ps(distTop, minDist));
+                const __m128 selBottom = _mm_andnot_ps(_mm_or_ps(selX, selTop), allOnes);
+
+                const __m128 inNx = _mm_or_ps(_mm_and_ps(selLeft, minusOne), _mm_and_ps(selRight, one));
+                const __m128 inNy = _mm_or_ps(_mm_and_ps(selTop, minusOne), _mm_and_ps(selBottom, one));
+                const __m128 inPen = _mm_add_ps(vr, one);
+
+                nx = select(nx, inNx, inside);
+                ny = select(ny, inNy, inside);
+                pen = select(pen, inPen, inside);
+            }
+
+            _mm_storeu_ps(outNx + i, nx);
+            _mm_storeu_ps(outNy + i, ny);
+            _mm_storeu_ps(outPen + i, pen);
+            for (int k = 0; k < 4; k++)
+            {
+                const int bit = (mask >> k) & 1;
+                outHit[i + k] = static_cast<std::uint8_t>(bit);
+                hits += bit;
+            }
+        }
+
+        return hits + circleRectBatchScalar(cx, cy, radius, x + i, y + i, w + i, h + i, count - i,
+                                            outHit + i, outNx + i, outNy + i, outPen + i);
+    }
+
+#endif
+
+#if defined(CASSEBRIQUES_BATCH_AVX2)
+
+    // CollisionBatchAvx2.cpp
+    int circleRectBatchAvx2(float cx, float cy, float radius,
+                            const float *x, const float *y, const float *w, const float *h, std::size_t count,
+                            std::uint8_t *outHit, float *outNx, float *outNy, float *outPen);
+
+    namespace
+    {
+        // AVX2 instructions and the OS saving the YMM registers
+        bool cpuHasAvx2()
+        {
+#if defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7)
+                return false;
+            __cpuid(info, 1);
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            const bool avx = (info[2] & (1 << 28)) != 0;
+            if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+                return false;
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+#else
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") != 0;
+#endif
+        }
+    } // namespace
+
+#endif
+
+    const std::vector<BatchKernel> &batchKernels()
+    {
+        static const std::vector<BatchKernel> kernels = []
+        {
+            std::vector<BatchKernel> k;
+            k.push_back({"scalar", 1, circleRectBatchScalar});
+#if defined(CASSEBRIQUES_BATCH_SSE2)
+            k.push_back({"sse2", 4, circleRectBatchSse2});
+#endif
+#if defined(CASSEBRIQUES_BATCH_AVX2)
+            if (cpuHasAvx2())
+                k.push_back({"avx2", 8, circleRectBatchAvx2});
+#endif
+            return k;
+        }();
+        return kernels;
+    }
+
+    namespace
+    {
+        // Chosen once, on first use
+        const BatchKernel &activeKernel()
+        {
+            static const BatchKernel &kernel = batchKernels().back();
+            return kernel;
+        }
+    } // namespace
+
+    int batchWidth() { return activeKernel().width; }
+    const char *batchKernelName() { return activeKernel().name; }
+
+    int circleRectBatch(float cx, float cy, float radius,
+                        const float *x, const float *y, const float *w, const float *h, std::size_t count,
+                        std::uint8_t *outHit, float *outNx, float *outNy, float *outPen)
+    {
+        return activeKernel().run(cx, cy, radius, x, y, w, h, count, outHit, outNx, outNy, outPen);
+    }
+
+    void CircleRectBatch::clear()
+    {
+        x.clear();
+        y.clear();
+        w.clear();
+        h.clear();
+    }
+
+    void CircleRectBatch::add(float bx, float by, float bw, float bh)
+    {
+        x.push_back(bx);
+        y.push_back(by);
+        w.push_back(bw);
+        h.push_back(bh);
+    }
+
+    int CircleRectBatch::run(const Vec2 &center, float radius)
+    {
+        const std::size_t n = size();
+        hit.resize(n);
+        nx.resize(n);
+        ny.resize(n);
+        pen.resize(n);
+        if (n == 0)
+            return 0;
+        return circleRectBatch(center.x, center.y, radius, x.data(), y.data(), w.data(), h.data(), n,
+                               hit.data(), nx.data(), ny.data(), pen.data());
+    }
+
+} // namespace Collision
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Vec2.hpp"
+
+/**
+ * @brief Narrowphase vectorisée : un cercle contre plusieurs rectangles à la fois
+ *
+ * Même résultat que Collision::circleRectCollisionNormal, mais sur des rectangles
+ * rangés en tableaux (x, y, w, h) comme dans BrickField. Le noyau traite 8 boîtes
+ * par itération en AVX2, 4 en SSE2, et finit (ou remplace tout) en scalaire.
+ * Sur x86, le noyau AVX2 est toujours compilé (unité à part) et choisi au premier
+ * appel si le processeur l'a ; sinon SSE2, la base x86-64. Les trois noyaux donnent
+ * le même résultat au bit près (CasseBriques_bench --check).
+ */
+namespace Collision
+{
+    using BatchKernelFn = int (*)(float cx, float cy, float radius,
+                                  const float *x, const float *y, const float *w, const float *h, std::size_t count,
+                                  std::uint8_t *outHit, float *outNx, float *outNy, float *outPen);
+
+    /**
+     * @brief Un noyau de narrowphase : nom, boîtes par itération, fonction
+     */
+    struct BatchKernel
+    {
+        const char *name;
+        int width;
+        BatchKernelFn run;
+    };
+
+    /**
+     * @brief Noyaux utilisables sur ce processeur, du scalaire au plus large (celui de circleRectBatch)
+     */
+    const std::vector<BatchKernel> &batchKernels();
+
+    /**
+     * @brief Nombre de boîtes traitées par itération SIMD (8, 4 ou 1)
+     */
+    int batchWidth();
+
+    /**
+     * @brief Nom du noyau choisi ("avx2", "sse2" ou "scalar")
+     */
+    const char *batchKernelName();
+
+    /**
+     * @brief Teste un cercle contre count rectangles
+     * @param outHit 1 si chevauchement, 0 sinon (count éléments)
+     * @param outNx, outNy Normale (de la boîte vers le cercle), valide si outHit[i]
+     * @param outPen Profondeur de pénétration, valide si outHit[i]
+     * @return Nombre de rectangles touchés
+     */
+    int circleRectBatch(float cx, float cy, float radius,
+                        const float *x, const float *y, const float *w, const float *h, std::size_t count,
+                        std::uint8_t *outHit, float *outNx, float *outNy, float *outPen);
+
+    /**
+     * @brief Version scalaire de référence (même résultat, une boîte à la fois)
+     */
+    int circleRectBatchScalar(float cx, float cy, float radius,
+                              const float *x, const float *y, const float *w, const float *h, std::size_t count,
+                              std::uint8_t *outHit, float *outNx, float *outNy, float *outPen);
+
+    /**
+     * @brief Lot de rectangles candidats (rassemblés depuis la broadphase) et résultats
+     */
+    struct CircleRectBatch
+    {
+        std::vector<float> x;
+        std::vector<float> y;
+        std::vector<float> w;
+        std::vector<float> h;
+
+        std::vector<std::uint8_t> hit;
+        std::vector<float> nx;
+        std::vector<float> ny;
+        std::vector<float> pen;
+
+        void clear();
+        void add(float bx, float by, float bw, float bh);
+        std::size_t size() const { return x.size(); }
+
+        /**
+         * @brief Lance le noyau sur toutes les boîtes du lot ; retourne le nombre de touchées
+         */
+        int run(const Vec2 &center, float radius);
+    };
+} // namespace Collision
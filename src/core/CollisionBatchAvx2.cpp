@@ -0,0 +1,103 @@
+// AVX2 narrowphase kernel, compiled for AVX2 whatever the core's target and only called
+// when the CPU has it (selected once in CollisionBatch.cpp).
+
+#include "CollisionBatch.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+
+#include <algorithm>
+
+#include <immintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CASSEBRIQUES_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define CASSEBRIQUES_TARGET_AVX2 // MSVC: AVX2 intrinsics need no compiler flag
+#endif
+
+namespace Collision
+{
+
+    CASSEBRIQUES_TARGET_AVX2
+    int circleRectBatchAvx2(float cx, float cy, float radius,
+                            const float *x, const float *y, const float *w, const float *h, std::size_t count,
+                            std::uint8_t *outHit, float *outNx, float *outNy, float *outPen)
+    {
+        const __m256 vcx = _mm256_set1_ps(cx);
+        const __m256 vcy = _mm256_set1_ps(cy);
+        const __m256 vr = _mm256_set1_ps(radius);
+        const __m256 vr2 = _mm256_set1_ps(radius * radius);
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 minusOne = _mm256_set1_ps(-1.0f);
+
+        int hits = 0;
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 left = _mm256_loadu_ps(x + i);
+            const __m256 top = _mm256_loadu_ps(y + i);
+            const __m256 right = _mm256_add_ps(left, _mm256_loadu_ps(w + i));
+            const __m256 bottom = _mm256_add_ps(top, _mm256_loadu_ps(h + i));
+
+            const __m256 dx = _mm256_sub_ps(vcx, _mm256_max_ps(left, _mm256_min_ps(vcx, right)));
+            const __m256 dy = _mm256_sub_ps(vcy, _mm256_max_ps(top, _mm256_min_ps(vcy, bottom)));
+            const __m256 d2 = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+
+            const __m256 hitMask = _mm256_cmp_ps(d2, vr2, _CMP_LT_OQ);
+            const int mask = _mm256_movemask_ps(hitMask);
+            if (mask == 0)
+            {
+                std::fill(outHit + i, outHit + i + 8, std::uint8_t(0));
+                continue;
+            }
+
+            // Outside: normal = (dx, dy) / d
+            const __m256 d = _mm256_sqrt_ps(d2);
+            __m256 nx = _mm256_div_ps(dx, d);
+            __m256 ny = _mm256_div_ps(dy, d);
+            __m256 pen = _mm256_sub_ps(vr, d);
+
+            // Center inside the box: nearest side (left, right, top, bottom priority)
+            const __m256 inside = _mm256_and_ps(_mm256_cmp_ps(dx, zero, _CMP_EQ_OQ), _mm256_cmp_ps(dy, zero, _CMP_EQ_OQ));
+            if (_mm256_movemask_ps(inside) != 0)
+            {
+                const __m256 distLeft = _mm256_sub_ps(vcx, left);
+                const __m256 distRight = _mm256_sub_ps(right, vcx);
+                const __m256 distTop = _mm256_sub_ps(vcy, top);
+                const __m256 distBottom = _mm256_sub_ps(bottom, vcy);
+                const __m256 minDist = _mm256_min_ps(_mm256_min_ps(distLeft, distRight), _mm256_min_ps(distTop, distBottom));
+
+                const __m256 selLeft = _mm256_cmp_ps(distLeft, minDist, _CMP_EQ_OQ);
+                const __m256 selRight = _mm256_andnot_ps(selLeft, _mm256_cmp_ps(distRight, minDist, _CMP_EQ_OQ));
+                const __m256 selX = _mm256_or_ps(selLeft, selRight);
+                const __m256 selTop = _mm256_andnot_ps(selX, _mm256_cmp_ps(distTop, minDist, _CMP_EQ_OQ));
+                const __m256 selBottom = _mm256_andnot_ps(_mm256_or_ps(selX, selTop), _mm256_castsi256_ps(_mm256_set1_epi32(-1)));
+
+                const __m256 inNx = _mm256_or_ps(_mm256_and_ps(selLeft, minusOne), _mm256_and_ps(selRight, one));
+                const __m256 inNy = _mm256_or_ps(_mm256_and_ps(selTop, minusOne), _mm256_and_ps(selBottom, one));
+                const __m256 inPen = _mm256_add_ps(vr, one);
+
+                nx = _mm256_blendv_ps(nx, inNx, inside);
+                ny = _mm256_blendv_ps(ny, inNy, inside);
+                pen = _mm256_blendv_ps(pen, inPen, inside);
+            }
+
+            _mm256_storeu_ps(outNx + i, nx);
+            _mm256_storeu_ps(outNy + i, ny);
+            _mm256_storeu_ps(outPen + i, pen);
+            for (int k = 0; k < 8; k++)
+            {
+                const int bit = (mask >> k) & 1;
+                outHit[i + k] = static_cast<std::uint8_t>(bit);
+                hits += bit;
+            }
+        }
+
+        return hits + circleRectBatchScalar(cx, cy, radius, x + i, y + i, w + i, h + i, count - i,
+                                            outHit + i, outNx + i, outNy + i, outPen + i);
+    }
+
+} // namespace Collision
+
+#endif
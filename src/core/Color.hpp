@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Couleur RGBA (sans dépendance SFML) portée par les objets du jeu
+ *
+ * La conversion vers sf::Color est faite côté rendu (voir render/ObjectRenderer.hpp).
+ */
+struct Color
+{
+    std::uint8_t r = 0;
+    std::uint8_t g = 0;
+    std::uint8_t b = 0;
+    std::uint8_t a = 255;
+
+    constexpr Color() = default;
+    constexpr Color(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a = 255)
+        : r(r), g(g), b(b), a(a) {}
+
+    constexpr bool operator==(const Color &o) const { return r == o.r && g == o.g && b == o.b && a == o.a; }
+    constexpr bool operator!=(const Color &o) const { return !(*this == o); }
+
+    static const Color White;
+    static const Color Red;
+    static const Color Yellow;
+    static const Color Green;
+    static const Color Cyan;
+};
+
+inline constexpr Color Color::White{255, 255, 255};
+inline constexpr Color Color::Red{255, 0, 0};
+inline constexpr Color Color::Yellow{255, 255, 0};
+inline constexpr Color Color::Green{0, 255, 0};
+inline constexpr Color Color::Cyan{0, 255, 255};
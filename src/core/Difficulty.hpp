@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+enum class Difficulty : std::uint8_t
+{
+    Easy = 0,
+    Normal = 1,
+    Hard = 2,
+};
@@ -0,0 +1,80 @@
+#include "FramePacer.hpp"
+
+#include "Trace.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+FramePacer::FramePacer(int hz)
+{
+#if defined(_WIN32)
+    // 1 ms scheduler resolution, otherwise every sleep rounds up to ~15.6 ms
+    timeBeginPeriod(1);
+#endif
+    setTargetHz(hz);
+}
+
+FramePacer::~FramePacer()
+{
+#if defined(_WIN32)
+    timeEndPeriod(1);
+#endif
+}
+
+void FramePacer::setTargetHz(int hz)
+{
+    targetHz = std::max(0, hz);
+    period = targetHz > 0 ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / targetHz))
+                          : Clock::duration::zero();
+    started = false;
+}
+
+void FramePacer::wait()
+{
+    TRACE_SCOPE("FramePacer::wait");
+
+    if (targetHz <= 0)
+        return;
+
+    const Clock::time_point now = Clock::now();
+    if (!started)
+    {
+        started = true;
+        deadline = now + period;
+        return;
+    }
+
+    // More than a frame late (hitch, window drag): start again from now, no burst of frames
+    if (now > deadline + period)
+    {
+        deadline = now + period;
+        return;
+    }
+
+    // Coarse part: sleep until the spin margin before the deadline
+    const Clock::time_point wake = deadline - std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(spinMargin));
+    if (now < wake)
+    {
+        std::this_thread::sleep_until(wake);
+
+        // Adapt the margin to how late the OS woke us
+        const double overshoot = std::chrono::duration<double>(Clock::now() - wake).count();
+        if (overshoot > spinMargin * 0.5)
+            spinMargin = std::min(MAX_SPIN, std::max(spinMargin, overshoot * 1.5));
+        else
+            spinMargin = std::max(MIN_SPIN, spinMargin * 0.99);
+    }
+
+    // Fine part: spin on the clock
+    while (Clock::now() < deadline)
+        std::this_thread::yield();
+
+    deadline += period;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <chrono>
+
+/**
+ * @brief Cadence d'images précise : sommeil puis attente active sur steady_clock
+ *
+ * sf::Window::setFramerateLimit dort jusqu'à l'échéance avec la granularité du système
+ * (jusqu'à ~15 ms sous Windows) : les images arrivent irrégulièrement. Ici, on dort
+ * jusqu'à un peu avant l'échéance (marge d'attente active), puis on attend activement
+ * la fin. La marge s'adapte au retard de réveil mesuré : elle grandit dès qu'un sommeil
+ * dépasse, et redescend lentement quand le système est précis.
+ *
+ * Les échéances sont espacées de 1 / cible à partir de la précédente (pas de la fin
+ * de l'attente) : la cadence ne dérive pas. Après un retard de plus d'une image, on
+ * repart de maintenant au lieu d'enchaîner des images pour rattraper.
+ */
+class FramePacer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @param targetHz Images par seconde (0 : pas de limite)
+     */
+    explicit FramePacer(int targetHz = 60);
+    ~FramePacer();
+
+    FramePacer(const FramePacer &) = delete;
+    FramePacer &operator=(const FramePacer &) = delete;
+
+    void setTargetHz(int hz);
+    int getTargetHz() const { return targetHz; }
+
+    /**
+     * @brief Attend l'échéance de l'image suivante (retour immédiat sans limite)
+     */
+    void wait();
+
+    /**
+     * @brief Marge d'attente active actuelle (secondes)
+     */
+    double getSpinMargin() const { return spinMargin; }
+
+private:
+    static constexpr double MIN_SPIN = 0.0002; // s
+    static constexpr double MAX_SPIN = 0.004;  // s; beyond that, spinning costs more than jitter
+
+    int targetHz = 0;
+    Clock::duration period{};
+    Clock::time_point deadline;
+    bool started = false;
+    double spinMargin = 0.002;
+};
@@ -1,19 +1,20 @@
 #include "GameObject.hpp"
+#include <algorithm>
 #include <cmath>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
-GameObject::GameObject(float x, float y, float width, float height, const sf::Color &col)
+GameObject::GameObject(float x, float y, float width, float height, const Color &col)
     : position(x, y), size(width, height), radius(0.0f), isCircle(false),
-      velocity(0.0f, 0.0f), rotation(0.0f), color(col)
+      velocity(0.0f, 0.0f), rotation(0.0f), color(col), previousPosition(x, y)
 {
 }
 
-GameObject::GameObject(float x, float y, float radius, const sf::Color &col)
+GameObject::GameObject(float x, float y, float radius, const Color &col)
     : position(x, y), size(0.0f, 0.0f), radius(radius), isCircle(true),
-      velocity(0.0f, 0.0f), rotation(0.0f), color(col)
+      velocity(0.0f, 0.0f), rotation(0.0f), color(col), previousPosition(x, y)
 {
 }
 
@@ -23,27 +24,24 @@ void GameObject::update(float deltaTime)
     position += velocity * deltaTime;
 }
 
-void GameObject::draw(sf::RenderWindow &window)
+void GameObject::savePreviousPosition()
 {
-    if (isCircle)
-    {
-        // Dessiner un cercle
-        sf::CircleShape circle(radius);
-        circle.setPosition(position);
-        circle.setOrigin(radius, radius); // Origine au centre
-        circle.setFillColor(color);
-        circle.setRotation(rotation);
-        window.draw(circle);
-    }
-    else
-    {
-        // Dessiner un rectangle
-        sf::RectangleShape rect(size);
-        rect.setPosition(position);
-        rect.setFillColor(color);
-        rect.setRotation(rotation);
-        window.draw(rect);
-    }
+    previousPosition = position;
+}
+
+void GameObject::setPreviousPosition(const Vec2 &pos)
+{
+    previousPosition = pos;
+}
+
+Vec2 GameObject::getPreviousPosition() const
+{
+    return previousPosition;
+}
+
+Vec2 GameObject::getInterpolatedPosition(float alpha) const
+{
+    return previousPosition + (position - previousPosition) * alpha;
 }
 
 AABB GameObject::getAABB() const
@@ -71,6 +69,19 @@ AABB GameObject::getAABB() const
     return box;
 }
 
+AABB GameObject::getSweptAABB() const
+{
+    AABB box = getAABB();
+    const float dx = previousPosition.x - position.x;
+    const float dy = previousPosition.y - position.y;
+
+    box.left = std::min(box.left, box.left + dx);
+    box.right = std::max(box.right, box.right + dx);
+    box.top = std::min(box.top, box.top + dy);
+    box.bottom = std::max(box.bottom, box.bottom + dy);
+    return box;
+}
+
 bool GameObject::checkCollision(const GameObject &other) const
 {
     // Test rapide avec AABB
@@ -122,6 +133,29 @@ bool GameObject::checkCollision(const GameObject &other) const
     return true;
 }
 
+bool GameObject::checkCollision(const AABB &box) const
+{
+    if (!getAABB().intersects(box))
+    {
+        return false;
+    }
+
+    // Rectangle-Rectangle : l'intersection AABB suffit
+    if (!isCircle)
+    {
+        return true;
+    }
+
+    // Cercle-AABB : point du rectangle le plus proche du centre
+    float closestX = std::max(box.left, std::min(position.x, box.right));
+    float closestY = std::max(box.top, std::min(position.y, box.bottom));
+
+    float dx = position.x - closestX;
+    float dy = position.y - closestY;
+
+    return dx * dx + dy * dy < radius * radius;
+}
+
 bool GameObject::isOutOfBounds(float screenWidth, float screenHeight) const
 {
     AABB box = getAABB();
@@ -132,12 +166,12 @@ bool GameObject::isOutOfBounds(float screenWidth, float screenHeight) const
 }
 
 // Getters
-sf::Vector2f GameObject::getPosition() const
+Vec2 GameObject::getPosition() const
 {
     return position;
 }
 
-sf::Vector2f GameObject::getSize() const
+Vec2 GameObject::getSize() const
 {
     return size;
 }
@@ -152,7 +186,7 @@ bool GameObject::getIsCircle() const
     return isCircle;
 }
 
-sf::Vector2f GameObject::getVelocity() const
+Vec2 GameObject::getVelocity() const
 {
     return velocity;
 }
@@ -162,30 +196,30 @@ float GameObject::getRotation() const
     return rotation;
 }
 
-sf::Color GameObject::getColor() const
+Color GameObject::getColor() const
 {
     return color;
 }
 
 // Setters
-void GameObject::setPosition(const sf::Vector2f &pos)
+void GameObject::setPosition(const Vec2 &pos)
 {
     position = pos;
 }
 
 void GameObject::setPosition(float x, float y)
 {
-    position = sf::Vector2f(x, y);
+    position = Vec2(x, y);
 }
 
-void GameObject::setVelocity(const sf::Vector2f &vel)
+void GameObject::setVelocity(const Vec2 &vel)
 {
     velocity = vel;
 }
 
 void GameObject::setVelocity(float vx, float vy)
 {
-    velocity = sf::Vector2f(vx, vy);
+    velocity = Vec2(vx, vy);
 }
 
 void GameObject::setRotation(float rot)
@@ -193,7 +227,7 @@ void GameObject::setRotation(float rot)
     rotation = rot;
 }
 
-void GameObject::setColor(const sf::Color &col)
+void GameObject::setColor(const Color &col)
 {
     color = col;
 }
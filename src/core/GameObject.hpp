@@ -1,53 +1,73 @@
 #pragma once
 
-#include <SFML/Graphics.hpp>
 #include "AABB.hpp"
+#include "Color.hpp"
+#include "Vec2.hpp"
 
 /**
  * @brief Classe de base pour tous les objets du jeu
  *
- * Gère la position, la taille, la vitesse, la rotation et les collisions
+ * Gère la position, la taille, la vitesse, la rotation et les collisions.
+ * Aucune dépendance SFML : le dessin est fait par render/ObjectRenderer.
  */
 class GameObject
 {
 protected:
-    sf::Vector2f position; // Position (x, y)
-    sf::Vector2f size;     // Taille (width, height) - pour rectangle
-    float radius;          // Rayon - pour cercle
-    bool isCircle;         // true si forme circulaire, false si rectangle
-    sf::Vector2f velocity; // Vitesse (vx, vy)
-    float rotation;        // Angle de rotation en degrés
-    sf::Color color;       // Couleur de l'objet
+    Vec2 position;  // Position (x, y)
+    Vec2 size;      // Taille (width, height) - pour rectangle
+    float radius;   // Rayon - pour cercle
+    bool isCircle;  // true si forme circulaire, false si rectangle
+    Vec2 velocity;  // Vitesse (vx, vy)
+    float rotation; // Angle de rotation en degrés
+    Color color;    // Couleur de l'objet
+
+    Vec2 previousPosition; // Position au pas de simulation précédent (interpolation du rendu)
 
 public:
     /**
      * @brief Constructeur pour un rectangle
      */
-    GameObject(float x, float y, float width, float height, const sf::Color &col = sf::Color::White);
+    GameObject(float x, float y, float width, float height, const Color &col = Color::White);
 
     /**
      * @brief Constructeur pour un cercle
      */
-    GameObject(float x, float y, float radius, const sf::Color &col = sf::Color::White);
+    GameObject(float x, float y, float radius, const Color &col = Color::White);
 
     virtual ~GameObject() = default;
 
     // Getters
-    sf::Vector2f getPosition() const;
-    sf::Vector2f getSize() const;
+    Vec2 getPosition() const;
+    Vec2 getSize() const;
     float getRadius() const;
     bool getIsCircle() const;
-    sf::Vector2f getVelocity() const;
+    Vec2 getVelocity() const;
     float getRotation() const;
-    sf::Color getColor() const;
+    Color getColor() const;
 
     // Setters
-    void setPosition(const sf::Vector2f &pos);
+    void setPosition(const Vec2 &pos);
     void setPosition(float x, float y);
-    void setVelocity(const sf::Vector2f &vel);
+    void setVelocity(const Vec2 &vel);
     void setVelocity(float vx, float vy);
     void setRotation(float rot);
-    void setColor(const sf::Color &col);
+    void setColor(const Color &col);
+
+    /**
+     * @brief Mémorise la position courante comme état "précédent"
+     *
+     * Appelé au début de chaque pas fixe de simulation ; le rendu interpole
+     * ensuite entre la position précédente et la position courante.
+     */
+    void savePreviousPosition();
+    void setPreviousPosition(const Vec2 &pos);
+    Vec2 getPreviousPosition() const;
+
+    /**
+     * @brief Position interpolée entre le pas précédent et le pas courant
+     * @param alpha Fraction du pas écoulée depuis le dernier pas (0..1)
+     */
+    Vec2 getInterpolatedPosition(float alpha) const;
 
     /**
      * @brief Met à jour l'objet (position, etc.)
@@ -56,15 +76,14 @@ public:
     virtual void update(float deltaTime);
 
     /**
-     * @brief Dessine l'objet dans la fenêtre
-     * @param window Fenêtre SFML où dessiner
+     * @brief Calcule et retourne la zone de collision AABB
      */
-    virtual void draw(sf::RenderWindow &window);
+    AABB getAABB() const;
 
     /**
-     * @brief Calcule et retourne la zone de collision AABB
+     * @brief AABB balayée entre la position précédente et la position courante
      */
-    AABB getAABB() const;
+    AABB getSweptAABB() const;
 
     /**
      * @brief Vérifie la collision avec un autre GameObject
@@ -73,6 +92,13 @@ public:
      */
     bool checkCollision(const GameObject &other) const;
 
+    /**
+     * @brief Vérifie la collision avec un rectangle statique (ex : brique d'un BrickField)
+     * @param box Le rectangle à tester
+     * @return true si collision, false sinon
+     */
+    bool checkCollision(const AABB &box) const;
+
     /**
      * @brief Vérifie si l'objet est hors des limites de l'écran
      * @param screenWidth Largeur de l'écran
@@ -1,128 +1,287 @@
 #include "InputManager.hpp"
 
-InputManager::InputManager()
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace
 {
-    // Initialiser tous les états à false
-    for (int i = 0; i < sf::Keyboard::KeyCount; i++)
+    void dispatch(const std::vector<std::function<void()>> &callbacks)
     {
-        keyStates[static_cast<sf::Keyboard::Key>(i)] = false;
+        for (const auto &callback : callbacks)
+            callback();
     }
+} // namespace
 
-    for (int i = 0; i < sf::Mouse::ButtonCount; i++)
-    {
-        mouseButtonStates[static_cast<sf::Mouse::Button>(i)] = false;
-    }
+void InputManager::processEvent(const sf::Event &event)
+{
+    processEvent(event, InputSampler::now());
 }
 
-void InputManager::processEvent(const sf::Event &event)
+void InputManager::processEvent(const sf::Event &event, double time)
 {
-    if (event.type == sf::Event::KeyPressed)
+    switch (event.type)
     {
-        keyStates[event.key.code] = true;
+    case sf::Event::KeyPressed:
+    case sf::Event::KeyReleased:
+    case sf::Event::MouseButtonPressed:
+    case sf::Event::MouseButtonReleased:
+        markInput(time);
+        break;
+    case sf::Event::MouseMoved:
+        if (!sampled())
+            markInput(time);
+        break;
+    default:
+        break;
+    }
 
-        // Appeler tous les callbacks pour cette touche
-        if (keyPressedCallbacks.find(event.key.code) != keyPressedCallbacks.end())
-        {
-            for (auto &callback : keyPressedCallbacks[event.key.code])
-            {
-                callback();
-            }
-        }
+    switch (event.type)
+    {
+    case sf::Event::KeyPressed:
+    {
+        const int key = event.key.code;
+        if (!InputSnapshot::validKey(key) || state.keysDown[key])
+            return; // touche inconnue ou répétition automatique
+
+        state.keysDown[key] = true;
+        state.keysPressed[key] = true;
+        dispatch(keyPressedCallbacks[key]);
+        break;
     }
-    else if (event.type == sf::Event::KeyReleased)
+    case sf::Event::KeyReleased:
     {
-        keyStates[event.key.code] = false;
+        const int key = event.key.code;
+        if (!InputSnapshot::validKey(key))
+            return;
 
-        // Appeler tous les callbacks pour cette touche
-        if (keyReleasedCallbacks.find(event.key.code) != keyReleasedCallbacks.end())
-        {
-            for (auto &callback : keyReleasedCallbacks[event.key.code])
-            {
-                callback();
-            }
-        }
+        state.keysDown[key] = false;
+        state.keysReleased[key] = true;
+        dispatch(keyReleasedCallbacks[key]);
+        break;
     }
-    else if (event.type == sf::Event::MouseButtonPressed)
+    case sf::Event::MouseButtonPressed:
     {
-        mouseButtonStates[event.mouseButton.button] = true;
+        const int button = event.mouseButton.button;
+        if (!InputSnapshot::validButton(button) || (sampled() && button == sf::Mouse::Left))
+            return;
 
-        // Appeler tous les callbacks pour ce bouton
-        if (mousePressedCallbacks.find(event.mouseButton.button) != mousePressedCallbacks.end())
+        state.mousePosition = sf::Vector2i(event.mouseButton.x, event.mouseButton.y);
+        if (button == sf::Mouse::Left)
         {
-            for (auto &callback : mousePressedCallbacks[event.mouseButton.button])
-            {
-                callback();
-            }
+            pressLeft(state.mousePosition, 0.0f);
+            break;
         }
+        state.buttonsDown[button] = true;
+        state.buttonsPressed[button] = true;
+        dispatch(mousePressedCallbacks[button]);
+        break;
     }
-    else if (event.type == sf::Event::MouseButtonReleased)
+    case sf::Event::MouseButtonReleased:
     {
-        mouseButtonStates[event.mouseButton.button] = false;
+        const int button = event.mouseButton.button;
+        if (!InputSnapshot::validButton(button) || (sampled() && button == sf::Mouse::Left))
+            return;
 
-        // Appeler tous les callbacks pour ce bouton
-        if (mouseReleasedCallbacks.find(event.mouseButton.button) != mouseReleasedCallbacks.end())
+        state.mousePosition = sf::Vector2i(event.mouseButton.x, event.mouseButton.y);
+        if (button == sf::Mouse::Left)
         {
-            for (auto &callback : mouseReleasedCallbacks[event.mouseButton.button])
-            {
-                callback();
-            }
+            releaseLeft();
+            break;
         }
+        state.buttonsDown[button] = false;
+        state.buttonsReleased[button] = true;
+        dispatch(mouseReleasedCallbacks[button]);
+        break;
+    }
+    case sf::Event::MouseMoved:
+        if (!sampled())
+            state.mousePosition = sf::Vector2i(event.mouseMove.x, event.mouseMove.y);
+        break;
+    case sf::Event::LostFocus:
+        // Les relâchements hors de la fenêtre ne sont jamais reçus
+        releaseAll();
+        if (sampler)
+            sampler->setActive(false);
+        break;
+    case sf::Event::GainedFocus:
+        if (sampler)
+            sampler->setActive(true);
+        break;
+    case sf::Event::Resized:
+        if (sampler)
+            sampler->setWindowSize(sf::Vector2u(event.size.width, event.size.height));
+        break;
+    default:
+        break;
     }
 }
 
+void InputManager::pressLeft(sf::Vector2i position, float at)
+{
+    if (state.buttonsDown[sf::Mouse::Left])
+        return;
+
+    // Several clicks in one step: the first one times the shot
+    if (!state.buttonsPressed[sf::Mouse::Left])
+    {
+        state.leftPressAt = at;
+        state.leftPressPosition = position;
+    }
+    state.buttonsDown[sf::Mouse::Left] = true;
+    state.buttonsPressed[sf::Mouse::Left] = true;
+    dispatch(mousePressedCallbacks[sf::Mouse::Left]);
+}
+
+void InputManager::releaseLeft()
+{
+    state.buttonsDown[sf::Mouse::Left] = false;
+    state.buttonsReleased[sf::Mouse::Left] = true;
+    dispatch(mouseReleasedCallbacks[sf::Mouse::Left]);
+}
+
+void InputManager::releaseAll()
+{
+    state.keysReleased |= state.keysDown;
+    state.keysDown.reset();
+    state.buttonsReleased |= state.buttonsDown;
+    state.buttonsDown.reset();
+}
+
 void InputManager::update(const sf::RenderWindow &window)
 {
     // Mettre à jour la position de la souris
-    mousePosition = sf::Mouse::getPosition(window);
+    state.mousePosition = sf::Mouse::getPosition(window);
 
     // Convertir en coordonnées du monde (si nécessaire)
-    sf::Vector2f worldPos = window.mapPixelToCoords(mousePosition);
+    sf::Vector2f worldPos = window.mapPixelToCoords(state.mousePosition);
     mousePositionWorld = sf::Vector2i(static_cast<int>(worldPos.x), static_cast<int>(worldPos.y));
 }
 
+InputSnapshot InputManager::takeSnapshot()
+{
+    const InputSnapshot snapshot = state;
+
+    state.keysPressed.reset();
+    state.keysReleased.reset();
+    state.buttonsPressed.reset();
+    state.buttonsReleased.reset();
+    state.leftPressAt = 0.0f;
+    state.tick++;
+
+    if (pendingInputTime > 0.0 && (consumedInputTime == 0.0 || pendingInputTime < consumedInputTime))
+        consumedInputTime = pendingInputTime;
+    pendingInputTime = 0.0;
+    return snapshot;
+}
+
+void InputManager::markInput(double time)
+{
+    if (pendingInputTime == 0.0 || time < pendingInputTime)
+        pendingInputTime = time;
+}
+
+double InputManager::takeInputTime()
+{
+    const double t = consumedInputTime;
+    consumedInputTime = 0.0;
+    return t;
+}
+
+InputSnapshot InputManager::takeSnapshot(double stepStart, double stepSeconds)
+{
+    if (sampled())
+        applySamples(stepStart, stepSeconds);
+    return takeSnapshot();
+}
+
+void InputManager::attach(InputSampler *inputSampler)
+{
+    sampler = inputSampler;
+    lastSample = MouseSample();
+}
+
+void InputManager::applySamples(double stepStart, double stepSeconds)
+{
+    const double stepEnd = stepStart + stepSeconds;
+    SpscQueue<MouseSample> &queue = sampler->samples();
+
+    // Everything up to the end of this step; later samples belong to later steps.
+    // Samples older than the step (time dropped by the catch-up limit) count at its start.
+    while (const MouseSample *s = queue.front())
+    {
+        if (s->time > stepEnd)
+            break;
+
+        state.mousePosition = s->position;
+        if (s->left && !state.buttonsDown[sf::Mouse::Left])
+        {
+            const double at = (s->time - stepStart) / stepSeconds;
+            pressLeft(s->position, static_cast<float>(std::max(0.0, std::min(at, 1.0))));
+        }
+        else if (!s->left && state.buttonsDown[sf::Mouse::Left])
+        {
+            releaseLeft();
+        }
+
+        markInput(s->time);
+        lastSample = *s;
+        queue.pop();
+    }
+
+    // Cursor at the end of the step: between the last sample and the next one. Samples
+    // are sent on change only, so the motion started at most one period before the next.
+    if (const MouseSample *next = queue.front())
+    {
+        const double from = std::max(lastSample.time, next->time - sampler->getPeriod());
+        if (next->time > from && stepEnd > from)
+        {
+            const double u = std::min((stepEnd - from) / (next->time - from), 1.0);
+            const sf::Vector2i a = lastSample.position;
+            const sf::Vector2i b = next->position;
+            state.mousePosition = sf::Vector2i(a.x + static_cast<int>(std::lround((b.x - a.x) * u)),
+                                               a.y + static_cast<int>(std::lround((b.y - a.y) * u)));
+        }
+    }
+}
+
 void InputManager::registerKeyPressedCallback(sf::Keyboard::Key key, std::function<void()> callback)
 {
-    keyPressedCallbacks[key].push_back(callback);
+    if (InputSnapshot::validKey(key))
+        keyPressedCallbacks[key].push_back(std::move(callback));
 }
 
 void InputManager::registerKeyReleasedCallback(sf::Keyboard::Key key, std::function<void()> callback)
 {
-    keyReleasedCallbacks[key].push_back(callback);
+    if (InputSnapshot::validKey(key))
+        keyReleasedCallbacks[key].push_back(std::move(callback));
 }
 
 void InputManager::registerMousePressedCallback(sf::Mouse::Button button, std::function<void()> callback)
 {
-    mousePressedCallbacks[button].push_back(callback);
+    if (InputSnapshot::validButton(button))
+        mousePressedCallbacks[button].push_back(std::move(callback));
 }
 
 void InputManager::registerMouseReleasedCallback(sf::Mouse::Button button, std::function<void()> callback)
 {
-    mouseReleasedCallbacks[button].push_back(callback);
+    if (InputSnapshot::validButton(button))
+        mouseReleasedCallbacks[button].push_back(std::move(callback));
 }
 
 bool InputManager::isKeyPressed(sf::Keyboard::Key key) const
 {
-    auto it = keyStates.find(key);
-    if (it != keyStates.end())
-    {
-        return it->second;
-    }
-    return false;
+    return state.isDown(key);
 }
 
 bool InputManager::isMouseButtonPressed(sf::Mouse::Button button) const
 {
-    auto it = mouseButtonStates.find(button);
-    if (it != mouseButtonStates.end())
-    {
-        return it->second;
-    }
-    return false;
+    return state.isDown(button);
 }
 
 sf::Vector2i InputManager::getMousePosition() const
 {
-    return mousePosition;
+    return state.mousePosition;
 }
 
 sf::Vector2i InputManager::getMousePositionWorld() const
@@ -2,50 +2,158 @@
 
 #include <SFML/Window.hpp>
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <bitset>
+#include <cstdint>
 #include <functional>
-#include <map>
 #include <vector>
 
+#include "InputSampler.hpp"
+
+/**
+ * @brief État des entrées vu par un pas de simulation
+ *
+ * Valeur immuable et copiable (quelques dizaines d'octets) : touches et boutons enfoncés,
+ * fronts (pressé / relâché) survenus depuis le pas précédent, position de la souris.
+ * Une pression et un relâchement dans le même pas restent visibles via wasPressed().
+ */
+struct InputSnapshot
+{
+    std::bitset<sf::Keyboard::KeyCount> keysDown;
+    std::bitset<sf::Keyboard::KeyCount> keysPressed;
+    std::bitset<sf::Keyboard::KeyCount> keysReleased;
+
+    std::bitset<sf::Mouse::ButtonCount> buttonsDown;
+    std::bitset<sf::Mouse::ButtonCount> buttonsPressed;
+    std::bitset<sf::Mouse::ButtonCount> buttonsReleased;
+
+    sf::Vector2i mousePosition; // pixels de la fenêtre (fin du pas si échantillonnée)
+    std::uint32_t tick = 0;     // numéro du pas (InputManager::takeSnapshot)
+
+    // Appui du bouton gauche pendant ce pas : instant (fraction du pas, 0 sans
+    // échantillonnage) et position de la souris à cet instant
+    float leftPressAt = 0.0f;
+    sf::Vector2i leftPressPosition;
+
+    bool isDown(sf::Keyboard::Key key) const { return validKey(key) && keysDown[key]; }
+    bool wasPressed(sf::Keyboard::Key key) const { return validKey(key) && keysPressed[key]; }
+    bool wasReleased(sf::Keyboard::Key key) const { return validKey(key) && keysReleased[key]; }
+
+    bool isDown(sf::Mouse::Button button) const { return validButton(button) && buttonsDown[button]; }
+    bool wasPressed(sf::Mouse::Button button) const { return validButton(button) && buttonsPressed[button]; }
+    bool wasReleased(sf::Mouse::Button button) const { return validButton(button) && buttonsReleased[button]; }
+
+    /**
+     * @brief Bouton enfoncé pendant ce pas, même s'il a déjà été relâché (clic très court)
+     */
+    bool isHeld(sf::Mouse::Button button) const { return isDown(button) || wasPressed(button); }
+
+    sf::Vector2f mouse() const
+    {
+        return sf::Vector2f(static_cast<float>(mousePosition.x), static_cast<float>(mousePosition.y));
+    }
+
+    static bool validKey(int key) { return key >= 0 && key < sf::Keyboard::KeyCount; }
+    static bool validButton(int button) { return button >= 0 && button < sf::Mouse::ButtonCount; }
+};
+
 /**
  * @brief Gestionnaire d'entrées (clavier et souris)
  *
- * Permet d'enregistrer des callbacks pour réagir aux événements
+ * Les événements SFML mettent à jour un état plat indexé par code de touche ; chaque pas
+ * de simulation en prend un instantané (takeSnapshot) qui porte les fronts du pas.
+ * Les callbacks sont rangés par code : leur appel ne fait aucune allocation.
  */
 class InputManager
 {
 private:
-    // Callbacks pour les touches du clavier
-    std::map<sf::Keyboard::Key, std::vector<std::function<void()>>> keyPressedCallbacks;
-    std::map<sf::Keyboard::Key, std::vector<std::function<void()>>> keyReleasedCallbacks;
+    using Callbacks = std::vector<std::function<void()>>;
 
-    // Callbacks pour les boutons de la souris
-    std::map<sf::Mouse::Button, std::vector<std::function<void()>>> mousePressedCallbacks;
-    std::map<sf::Mouse::Button, std::vector<std::function<void()>>> mouseReleasedCallbacks;
+    // Callbacks pour les touches du clavier (indexés par sf::Keyboard::Key)
+    std::array<Callbacks, sf::Keyboard::KeyCount> keyPressedCallbacks;
+    std::array<Callbacks, sf::Keyboard::KeyCount> keyReleasedCallbacks;
 
-    // État actuel des touches et boutons
-    std::map<sf::Keyboard::Key, bool> keyStates;
-    std::map<sf::Mouse::Button, bool> mouseButtonStates;
+    // Callbacks pour les boutons de la souris (indexés par sf::Mouse::Button)
+    std::array<Callbacks, sf::Mouse::ButtonCount> mousePressedCallbacks;
+    std::array<Callbacks, sf::Mouse::ButtonCount> mouseReleasedCallbacks;
+
+    // État courant + fronts accumulés depuis le dernier instantané
+    InputSnapshot state;
 
-    // Position de la souris
-    sf::Vector2i mousePosition;
     sf::Vector2i mousePositionWorld; // Position dans le monde (si vue transformée)
 
+    // Source datée de la souris (position + bouton gauche), à la place des événements
+    InputSampler *sampler = nullptr;
+    MouseSample lastSample; // dernier échantillon appliqué
+
+    // Mesure de latence : entrée la plus ancienne pas encore vue par un pas / déjà vue
+    double pendingInputTime = 0.0;
+    double consumedInputTime = 0.0;
+
+    void markInput(double time);
+
+    void releaseAll();
+    bool sampled() const { return sampler && sampler->isRunning(); }
+    void pressLeft(sf::Vector2i position, float at);
+    void releaseLeft();
+    void applySamples(double stepStart, double stepSeconds);
+
 public:
-    InputManager();
+    InputManager() = default;
     ~InputManager() = default;
 
     /**
      * @brief Traite un événement SFML
      * @param event L'événement à traiter
+     *
+     * La répétition automatique du clavier ne produit pas de nouveau front.
+     * La perte du focus relâche tout (pas de touche bloquée).
      */
     void processEvent(const sf::Event &event);
 
     /**
-     * @brief Met à jour l'état (position de la souris, etc.)
+     * @brief Idem, pour un événement reçu à l'instant time (horloge InputSampler::now())
+     *        par un autre thread
+     */
+    void processEvent(const sf::Event &event, double time);
+
+    /**
+     * @brief Relit la position de la souris auprès du système
      * @param window Fenêtre SFML pour obtenir la position de la souris
      */
     void update(const sf::RenderWindow &window);
 
+    /**
+     * @brief Instantané pour un pas de simulation ; remet les fronts à zéro
+     */
+    InputSnapshot takeSnapshot();
+
+    /**
+     * @brief Instantané d'un pas couvrant [stepStart, stepStart + stepSeconds] (horloge
+     *        InputSampler::now())
+     *
+     * Avec un échantillonneur : applique les échantillons datés de ce pas (les suivants
+     * restent en file pour les pas suivants), date l'appui du bouton gauche dans le pas
+     * et interpole la position de la souris à la fin du pas.
+     */
+    InputSnapshot takeSnapshot(double stepStart, double stepSeconds);
+
+    /**
+     * @brief Branche un échantillonneur démarré (nullptr : événements seulement)
+     *
+     * Le bouton gauche et la position viennent alors de ses échantillons ; les
+     * événements de focus et de taille lui sont transmis.
+     */
+    void attach(InputSampler *inputSampler);
+
+    /**
+     * @brief Instant (horloge InputSampler::now()) de la plus ancienne entrée transmise
+     *        à un pas depuis le dernier appel ; 0 si aucune
+     *
+     * Événement : instant où la fenêtre l'a livré. Échantillon : instant de l'échantillon.
+     */
+    double takeInputTime();
+
     /**
      * @brief Enregistre un callback pour une touche pressée
      * @param key La touche
@@ -98,4 +206,3 @@ public:
      */
     sf::Vector2i getMousePositionWorld() const;
 };
-
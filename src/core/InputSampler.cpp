@@ -0,0 +1,109 @@
+#include "InputSampler.hpp"
+
+#include "Trace.hpp"
+
+#include <chrono>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+InputSampler::~InputSampler()
+{
+    stop();
+}
+
+double InputSampler::now()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void InputSampler::start(const sf::Window &w, int hz)
+{
+    stop();
+
+    window = &w;
+    period = 1.0f / static_cast<float>(hz > 0 ? hz : 1000);
+    setWindowSize(w.getSize());
+    setActive(w.hasFocus());
+
+    running.store(true, std::memory_order_release);
+    thread = std::thread([this]
+                         { run(); });
+}
+
+void InputSampler::stop()
+{
+    running.store(false, std::memory_order_release);
+    if (thread.joinable())
+        thread.join();
+}
+
+void InputSampler::setActive(bool focused)
+{
+    if (focused)
+        resync.store(true, std::memory_order_relaxed);
+    active.store(focused, std::memory_order_release);
+}
+
+void InputSampler::setWindowSize(sf::Vector2u size)
+{
+    width.store(size.x, std::memory_order_relaxed);
+    height.store(size.y, std::memory_order_relaxed);
+}
+
+void InputSampler::run()
+{
+    TRACE_THREAD_NAME("input");
+
+#if defined(_WIN32)
+    // Default timer resolution is ~15.6 ms: sleeps of 1 ms need the 1 ms period
+    timeBeginPeriod(1);
+#endif
+
+    using Clock = std::chrono::steady_clock;
+    const auto step = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(period));
+    auto next = Clock::now();
+
+    MouseSample last;
+    bool pushed = false; // last holds what the consumer was sent
+    while (running.load(std::memory_order_acquire))
+    {
+        if (active.load(std::memory_order_acquire))
+        {
+            if (resync.exchange(false, std::memory_order_relaxed))
+                pushed = false;
+
+            MouseSample s;
+            s.time = now();
+            s.position = sf::Mouse::getPosition(*window);
+
+            const bool inside = s.position.x >= 0 && s.position.y >= 0 &&
+                                static_cast<unsigned>(s.position.x) < width.load(std::memory_order_relaxed) &&
+                                static_cast<unsigned>(s.position.y) < height.load(std::memory_order_relaxed);
+            const bool down = sf::Mouse::isButtonPressed(sf::Mouse::Left);
+            s.left = down && (inside || (pushed && last.left));
+
+            // Changes only; a full queue (consumer stalled) keeps the change for the next poll
+            if ((!pushed || s.left != last.left || s.position != last.position) && queue.push(s))
+            {
+                last = s;
+                pushed = true;
+            }
+        }
+
+        // Fixed rate; after a stall (debugger, suspended process) start again from now
+        next += step;
+        const auto t = Clock::now();
+        if (next < t)
+            next = t;
+        std::this_thread::sleep_until(next);
+    }
+
+#if defined(_WIN32)
+    timeEndPeriod(1);
+#endif
+}
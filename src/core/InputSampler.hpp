@@ -0,0 +1,82 @@
+#pragma once
+
+#include <SFML/Window.hpp>
+#include <atomic>
+#include <thread>
+
+#include "SpscQueue.hpp"
+
+/**
+ * @brief État de la souris à un instant précis
+ */
+struct MouseSample
+{
+    double time = 0.0;     // secondes (InputSampler::now())
+    sf::Vector2i position; // pixels de la fenêtre
+    bool left = false;     // bouton gauche enfoncé
+};
+
+/**
+ * @brief Thread d'échantillonnage de la souris (position + bouton gauche)
+ *
+ * SFML ne livre les événements qu'une fois par image, au thread de la fenêtre : à 30 fps,
+ * un clic peut attendre 33 ms. Ce thread interroge la souris à fréquence fixe (1 kHz par
+ * défaut), date chaque changement et le pousse dans une file SPSC sans verrou ;
+ * InputManager range ensuite chaque échantillon dans le pas de simulation qui couvre
+ * son instant.
+ *
+ * Un appui ne compte que dans la fenêtre et quand elle a le focus (setActive) ; le
+ * relâchement est suivi partout.
+ */
+class InputSampler
+{
+public:
+    InputSampler() = default;
+    ~InputSampler();
+
+    InputSampler(const InputSampler &) = delete;
+    InputSampler &operator=(const InputSampler &) = delete;
+
+    /**
+     * @brief Lance le thread (appel depuis le thread de la fenêtre)
+     * @param hz Fréquence d'échantillonnage
+     */
+    void start(const sf::Window &window, int hz);
+    void stop();
+    bool isRunning() const { return thread.joinable(); }
+
+    /**
+     * @brief Focus de la fenêtre (événements GainedFocus / LostFocus)
+     */
+    void setActive(bool focused);
+    void setWindowSize(sf::Vector2u size);
+
+    float getPeriod() const { return period; }
+
+    /**
+     * @brief Échantillons, du plus ancien au plus récent (consommateur : InputManager)
+     */
+    SpscQueue<MouseSample> &samples() { return queue; }
+
+    /**
+     * @brief Horloge des échantillons (secondes, monotone)
+     */
+    static double now();
+
+private:
+    static constexpr std::size_t QUEUE_CAPACITY = 1024; // ~1 s of constant motion at 1 kHz
+
+    const sf::Window *window = nullptr;
+    float period = 0.001f;
+
+    std::thread thread;
+    std::atomic<bool> running{false};
+    std::atomic<bool> active{false};
+    std::atomic<bool> resync{true}; // push the current state even if unchanged
+    std::atomic<unsigned> width{0};
+    std::atomic<unsigned> height{0};
+
+    SpscQueue<MouseSample> queue{QUEUE_CAPACITY};
+
+    void run();
+};
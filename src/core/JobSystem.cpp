@@ -0,0 +1,239 @@
+#include "JobSystem.hpp"
+
+#include "Trace.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    std::atomic<std::uint64_t> nextId{1};
+
+    // Registrations of the calling thread, one per JobSystem it uses (ids are never reused,
+    // so entries of destroyed instances are simply never matched again)
+    struct Registration
+    {
+        std::uint64_t owner = 0;
+        unsigned slot = 0;
+    };
+
+    constexpr std::size_t MAX_REGISTRATIONS = 8; // instances one thread uses in turn
+    thread_local Registration registrations[MAX_REGISTRATIONS];
+    thread_local std::size_t nextRegistration = 0; // oldest entry, replaced when all are taken
+
+    const Registration *findRegistration(std::uint64_t owner)
+    {
+        for (const Registration &r : registrations)
+            if (r.owner == owner)
+                return &r;
+        return nullptr;
+    }
+
+    void addRegistration(std::uint64_t owner, unsigned slot)
+    {
+        registrations[nextRegistration] = Registration{owner, slot};
+        nextRegistration = (nextRegistration + 1) % MAX_REGISTRATIONS;
+    }
+} // namespace
+
+JobSystem::JobSystem(unsigned threads)
+    : id(nextId.fetch_add(1, std::memory_order_relaxed))
+{
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    // The caller is the last of the threads: it helps while it waits
+    workerCount = threads - 1;
+    queues = std::make_unique<Queue[]>(maxThreads());
+
+    workers.reserve(workerCount);
+    for (unsigned i = 0; i < workerCount; i++)
+        workers.emplace_back([this, i]
+                             { workerLoop(i); });
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto &t : workers)
+        t.join();
+}
+
+unsigned JobSystem::threadIndex()
+{
+    if (const Registration *r = findRegistration(id))
+        return r->slot;
+
+    const unsigned n = externalThreads.fetch_add(1, std::memory_order_relaxed);
+    const unsigned slot = n < MAX_EXTERNAL_THREADS ? workerCount + n : NO_THREAD;
+    addRegistration(id, slot); // an overflowing thread does not take a slot on every call
+    return slot;
+}
+
+void JobSystem::push(unsigned self, Task task)
+{
+    task.group->pending.fetch_add(1, std::memory_order_relaxed);
+    {
+        Queue &q = queues[self];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        q.tasks.push_back(std::move(task));
+    }
+
+    // A sleeper checks queued after counting itself (both seq_cst): it either sees this
+    // task or is seen here and woken
+    queued.fetch_add(1);
+    if (sleepers.load() > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        wake.notify_one();
+    }
+}
+
+bool JobSystem::runOne(unsigned self)
+{
+    Task task;
+    bool found = false;
+
+    // Own queue first, newest task
+    {
+        Queue &q = queues[self];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (!q.tasks.empty())
+        {
+            task = std::move(q.tasks.back());
+            q.tasks.pop_back();
+            found = true;
+        }
+    }
+
+    // Then steal the oldest task of another thread, starting with the next one
+    const unsigned n = maxThreads();
+    for (unsigned k = 1; !found && k < n; k++)
+    {
+        Queue &q = queues[(self + k) % n];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (!q.tasks.empty())
+        {
+            task = std::move(q.tasks.front());
+            q.tasks.pop_front();
+            found = true;
+        }
+    }
+
+    if (!found)
+        return false;
+
+    queued.fetch_sub(1, std::memory_order_relaxed);
+    execute(task, self);
+    return true;
+}
+
+void JobSystem::execute(Task &task, unsigned self)
+{
+    Group &group = *task.group;
+    if (task.body)
+        runRange(*task.body, task.begin, task.end, task.grain, group, self);
+    else
+        task.job();
+    group.pending.fetch_sub(1, std::memory_order_release);
+}
+
+void JobSystem::runRange(const RangeBody &body, std::size_t begin, std::size_t end, std::size_t grain, Group &group, unsigned self)
+{
+    // Lazy binary splitting: leave the right half for thieves, keep going on the left
+    while (end - begin > grain)
+    {
+        const std::size_t mid = begin + (end - begin) / 2;
+        Task half;
+        half.body = &body;
+        half.begin = mid;
+        half.end = end;
+        half.grain = grain;
+        half.group = &group;
+        push(self, std::move(half));
+        end = mid;
+    }
+    body(begin, end, self);
+}
+
+void JobSystem::run(Group &group, Job job)
+{
+    const unsigned self = threadIndex();
+    if (self == NO_THREAD)
+    {
+        std::lock_guard<std::mutex> lock(overflowMutex);
+        job();
+        return;
+    }
+
+    Task task;
+    task.job = std::move(job);
+    task.group = &group;
+    push(self, std::move(task));
+}
+
+void JobSystem::wait(Group &group)
+{
+    TRACE_SCOPE("JobSystem::wait");
+
+    const unsigned self = threadIndex();
+    while (!group.done())
+    {
+        // Nothing left to take: the group's last tasks are running elsewhere
+        if (self == NO_THREAD || !runOne(self))
+            std::this_thread::yield();
+    }
+}
+
+void JobSystem::parallelFor(std::size_t count, std::size_t grain, const RangeBody &body)
+{
+    TRACE_SCOPE("JobSystem::parallelFor");
+
+    if (count == 0)
+        return;
+    grain = std::max<std::size_t>(grain, 1);
+
+    const unsigned self = threadIndex();
+    if (self == NO_THREAD)
+    {
+        std::lock_guard<std::mutex> lock(overflowMutex);
+        body(0, count, maxThreads() - 1);
+        return;
+    }
+
+    // Not worth splitting (or no one to share with)
+    if (workerCount == 0 && externalThreads.load(std::memory_order_relaxed) <= 1)
+        grain = count;
+
+    Group group;
+    group.pending.store(1, std::memory_order_relaxed); // the range run here
+    runRange(body, 0, count, grain, group, self);
+    group.pending.fetch_sub(1, std::memory_order_release);
+    wait(group);
+}
+
+void JobSystem::workerLoop(unsigned self)
+{
+    TRACE_THREAD_NAME("job");
+
+    addRegistration(id, self);
+
+    for (;;)
+    {
+        if (runOne(self))
+            continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepers.fetch_add(1);
+        wake.wait(lock, [this]
+                  { return stopping || queued.load() > 0; });
+        sleepers.fetch_sub(1);
+        if (stopping)
+            return;
+    }
+}
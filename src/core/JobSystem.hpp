@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Ordonnanceur de tâches à vol de travail (work stealing), pour découper le travail d'un pas
+ *
+ * Chaque thread qui s'en sert a sa propre file double : il y empile et reprend ses
+ * tâches par l'arrière (les plus récentes, données encore en cache), et un thread sans
+ * travail vole par l'avant chez les autres (les plus anciennes, donc les plus grosses
+ * moitiés d'une boucle découpée). Les threads de travail dorment quand il n'y a rien
+ * à voler.
+ *
+ * Fork-join : run(group, job) lance une tâche, wait(group) attend celles du groupe en
+ * exécutant du travail en attendant (une tâche peut donc attendre ses sous-tâches).
+ * parallelFor découpe [0, count) en deux récursivement jusqu'à grain indices.
+ *
+ * Contrairement à ThreadPool (une boucle à la fois, appelée d'un seul thread), plusieurs
+ * threads extérieurs (simulation, fenêtre) peuvent l'utiliser en même temps : chacun est
+ * enregistré à son premier appel et reçoit sa file et son numéro, jusqu'à
+ * MAX_EXTERNAL_THREADS. Au-delà, leurs appels s'exécutent sur place, un à la fois.
+ * Un thread garde son numéro dans chaque instance qu'il utilise (jusqu'à 8 à tour de rôle).
+ *
+ * Les tâches ne doivent pas lever d'exception.
+ */
+class JobSystem
+{
+public:
+    using Job = std::function<void()>;
+
+    /**
+     * body(begin, end, thread) : indices [begin, end) ; thread dans 0..maxThreads()-1,
+     * jamais partagé par deux tâches en cours (accumulateurs ou tampons par thread).
+     */
+    using RangeBody = std::function<void(std::size_t begin, std::size_t end, unsigned thread)>;
+
+    static constexpr unsigned MAX_EXTERNAL_THREADS = 4;
+
+    /**
+     * @brief Tâches lancées ensemble, attendues par wait()
+     */
+    class Group
+    {
+    public:
+        Group() = default;
+        Group(const Group &) = delete;
+        Group &operator=(const Group &) = delete;
+
+        bool done() const { return pending.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend class JobSystem;
+        std::atomic<int> pending{0};
+    };
+
+    /**
+     * @param threads Nombre de threads de calcul, un thread appelant compris (0 = nombre de cœurs)
+     */
+    explicit JobSystem(unsigned threads = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    unsigned getWorkerCount() const { return workerCount; }
+
+    /**
+     * @brief Borne (exclue) du numéro de thread passé aux RangeBody
+     */
+    unsigned maxThreads() const { return workerCount + MAX_EXTERNAL_THREADS + 1; }
+
+    /**
+     * @brief Lance job ; il peut s'exécuter sur n'importe quel thread, avant ou pendant wait()
+     */
+    void run(Group &group, Job job);
+
+    /**
+     * @brief Attend toutes les tâches du groupe, en exécutant des tâches en attendant
+     */
+    void wait(Group &group);
+
+    /**
+     * @brief Exécute body sur [0, count) découpé en tranches d'au moins grain indices et attend la fin
+     *
+     * Le thread appelant traite la première tranche ; les autres moitiés sont volées.
+     */
+    void parallelFor(std::size_t count, std::size_t grain, const RangeBody &body);
+
+private:
+    static constexpr unsigned NO_THREAD = ~0u;
+
+    struct Task
+    {
+        Job job;                          // or a range of a parallelFor:
+        const RangeBody *body = nullptr;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        std::size_t grain = 1;
+        Group *group = nullptr;
+    };
+
+    struct alignas(64) Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks; // owner: back, thieves: front
+    };
+
+    const std::uint64_t id; // tells thread registrations of successive instances apart
+    unsigned workerCount = 0;
+    std::unique_ptr<Queue[]> queues; // workers, then external threads
+    std::vector<std::thread> workers;
+    std::atomic<unsigned> externalThreads{0};
+    std::mutex overflowMutex; // external threads past MAX_EXTERNAL_THREADS
+
+    std::atomic<int> queued{0}; // tasks in all queues
+    std::atomic<int> sleepers{0};
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    bool stopping = false; // under sleepMutex
+
+    unsigned threadIndex();
+    void push(unsigned self, Task task);
+    bool runOne(unsigned self);
+    void execute(Task &task, unsigned self);
+    void runRange(const RangeBody &body, std::size_t begin, std::size_t end, std::size_t grain, Group &group, unsigned self);
+    void workerLoop(unsigned self);
+};
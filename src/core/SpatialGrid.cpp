@@ -0,0 +1,167 @@
+#include "SpatialGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(float cellW, float cellH)
+    : cellW(cellW), cellH(cellH)
+{
+}
+
+void SpatialGrid::rebuild(const std::vector<AABB> &boxes)
+{
+    cellStart.clear();
+    cellItems.clear();
+    stamps.assign(boxes.size(), 0);
+    currentStamp = 0;
+    cols = 0;
+    rows = 0;
+
+    if (boxes.empty())
+        return;
+
+    // Grid bounds = bounding box of the whole field
+    float minX = boxes[0].left;
+    float minY = boxes[0].top;
+    float maxX = boxes[0].right;
+    float maxY = boxes[0].bottom;
+    for (const auto &b : boxes)
+    {
+        minX = std::min(minX, b.left);
+        minY = std::min(minY, b.top);
+        maxX = std::max(maxX, b.right);
+        maxY = std::max(maxY, b.bottom);
+    }
+
+    originX = minX;
+    originY = minY;
+    cols = std::max(1, static_cast<int>(std::floor((maxX - minX) / cellW)) + 1);
+    rows = std::max(1, static_cast<int>(std::floor((maxY - minY) / cellH)) + 1);
+
+    // Pass 1: count items per cell
+    cellStart.assign(static_cast<size_t>(cols) * rows + 1, 0);
+    int c0, r0, c1, r1;
+    for (const auto &b : boxes)
+    {
+        if (!cellRange(b, c0, r0, c1, r1))
+            continue;
+        for (int r = r0; r <= r1; r++)
+            for (int c = c0; c <= c1; c++)
+                cellStart[r * cols + c + 1]++;
+    }
+
+    // Prefix sum -> start offsets
+    for (size_t i = 1; i < cellStart.size(); i++)
+        cellStart[i] += cellStart[i - 1];
+
+    // Pass 2: fill
+    cellItems.resize(cellStart.back());
+    std::vector<int> fill(cellStart.begin(), cellStart.end() - 1);
+    for (int i = 0; i < static_cast<int>(boxes.size()); i++)
+    {
+        if (!cellRange(boxes[i], c0, r0, c1, r1))
+            continue;
+        for (int r = r0; r <= r1; r++)
+            for (int c = c0; c <= c1; c++)
+                cellItems[fill[r * cols + c]++] = i;
+    }
+}
+
+void SpatialGrid::translate(float dx, float dy)
+{
+    originX += dx;
+    originY += dy;
+}
+
+bool SpatialGrid::cellRange(const AABB &box, int &c0, int &r0, int &c1, int &r1) const
+{
+    if (cols == 0 || rows == 0)
+        return false;
+
+    const float fc0 = std::floor((box.left - originX) / cellW);
+    const float fr0 = std::floor((box.top - originY) / cellH);
+    const float fc1 = std::floor((box.right - originX) / cellW);
+    const float fr1 = std::floor((box.bottom - originY) / cellH);
+
+    // Entirely outside the field
+    if (fc1 < 0.0f || fr1 < 0.0f || fc0 >= static_cast<float>(cols) || fr0 >= static_cast<float>(rows))
+        return false;
+
+    c0 = std::max(0, static_cast<int>(fc0));
+    r0 = std::max(0, static_cast<int>(fr0));
+    c1 = std::min(cols - 1, static_cast<int>(fc1));
+    r1 = std::min(rows - 1, static_cast<int>(fr1));
+    return true;
+}
+
+const std::vector<int> &SpatialGrid::query(const AABB &box)
+{
+    query(box, results);
+    return results;
+}
+
+void SpatialGrid::query(const AABB &box, std::vector<int> &out)
+{
+    out.clear();
+
+    int c0, r0, c1, r1;
+    if (!cellRange(box, c0, r0, c1, r1))
+        return;
+
+    if (++currentStamp == 0)
+    {
+        // Stamp counter wrapped: clear all stamps once
+        std::fill(stamps.begin(), stamps.end(), 0);
+        currentStamp = 1;
+    }
+
+    for (int r = r0; r <= r1; r++)
+    {
+        for (int c = c0; c <= c1; c++)
+        {
+            const int cell = r * cols + c;
+            for (int k = cellStart[cell]; k < cellStart[cell + 1]; k++)
+            {
+                const int id = cellItems[k];
+                if (stamps[id] == currentStamp)
+                    continue;
+                stamps[id] = currentStamp;
+                out.push_back(id);
+            }
+        }
+    }
+
+    // Same order as a linear scan over the bricks (keeps "first hit" semantics)
+    std::sort(out.begin(), out.end());
+}
+
+void SpatialGrid::queryConcurrent(const AABB &box, std::vector<int> &out) const
+{
+    out.clear();
+
+    int c0, r0, c1, r1;
+    if (!cellRange(box, c0, r0, c1, r1))
+        return;
+
+    for (int r = r0; r <= r1; r++)
+    {
+        for (int c = c0; c <= c1; c++)
+        {
+            const int cell = r * cols + c;
+            out.insert(out.end(), cellItems.begin() + cellStart[cell], cellItems.begin() + cellStart[cell + 1]);
+        }
+    }
+
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+AABB SpatialGrid::sweep(const AABB &from, const AABB &to)
+{
+    AABB box;
+    box.left = std::min(from.left, to.left);
+    box.top = std::min(from.top, to.top);
+    box.right = std::max(from.right, to.right);
+    box.bottom = std::max(from.bottom, to.bottom);
+    return box;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "AABB.hpp"
+
+/**
+ * @brief Grille uniforme (broadphase) sur un champ de briques
+ *
+ * Chaque brique est rangée dans les cellules que sa boîte recouvre ; une requête
+ * ne renvoie que les briques des cellules touchées par la boîte demandée
+ * (typiquement l'AABB balayée d'un projectile pendant un pas).
+ * Le pas des cellules est celui de la grille de briques (72+6 x 28+6 px).
+ *
+ * Les briques détruites ne sont pas retirées : l'appelant les ignore.
+ * Un champ qui se translate d'un bloc (descente Reborn) déplace seulement l'origine.
+ */
+class SpatialGrid
+{
+public:
+    static constexpr float DEFAULT_CELL_W = 72.0f + 6.0f;
+    static constexpr float DEFAULT_CELL_H = 28.0f + 6.0f;
+
+    explicit SpatialGrid(float cellW = DEFAULT_CELL_W, float cellH = DEFAULT_CELL_H);
+
+    /**
+     * @brief Reconstruit la grille ; l'indice de chaque boîte sert d'identifiant
+     * @param boxes Boîtes des briques (indice = position dans le conteneur de briques)
+     */
+    void rebuild(const std::vector<AABB> &boxes);
+
+    /**
+     * @brief Déplace toute la grille (toutes les briques ont bougé du même vecteur)
+     */
+    void translate(float dx, float dy);
+
+    /**
+     * @brief Retourne les indices (uniques, triés) des briques candidates pour une boîte
+     *
+     * La référence renvoyée reste valide jusqu'à la prochaine requête.
+     */
+    const std::vector<int> &query(const AABB &box);
+
+    /**
+     * @brief Variante qui écrit dans un tampon fourni (requêtes imbriquées)
+     */
+    void query(const AABB &box, std::vector<int> &out);
+
+    /**
+     * @brief Même résultat que query, sans état partagé : plusieurs threads à la fois
+     *
+     * Dédoublonne par tri au lieu des tampons de marquage.
+     */
+    void queryConcurrent(const AABB &box, std::vector<int> &out) const;
+
+    /**
+     * @brief AABB couvrant deux boîtes (boîte balayée entre deux positions)
+     */
+    static AABB sweep(const AABB &from, const AABB &to);
+
+private:
+    float cellW;
+    float cellH;
+    float originX = 0.0f;
+    float originY = 0.0f;
+    int cols = 0;
+    int rows = 0;
+
+    // Cellules stockées à plat (CSR) : les éléments de la cellule i sont
+    // cellItems[cellStart[i] .. cellStart[i + 1]).
+    std::vector<int> cellStart;
+    std::vector<int> cellItems;
+
+    // Dédoublonnage des briques qui recouvrent plusieurs cellules
+    std::vector<std::uint32_t> stamps;
+    std::uint32_t currentStamp = 0;
+
+    std::vector<int> results;
+
+    bool cellRange(const AABB &box, int &c0, int &r0, int &c1, int &r1) const;
+};
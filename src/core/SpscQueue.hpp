@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief File sans verrou à un producteur et un consommateur (anneau de taille fixe)
+ *
+ * Un seul thread appelle push(), un seul autre appelle front() / pop(). Aucune allocation
+ * après la construction. Les indices d'écriture et de lecture sont sur des lignes de
+ * cache séparées, et chaque côté garde une copie de l'indice de l'autre : il ne relit
+ * l'atomique partagé que lorsque la file lui paraît pleine (ou vide).
+ */
+template <typename T>
+class SpscQueue
+{
+public:
+    /**
+     * @param capacity Nombre d'éléments, arrondi à la puissance de deux supérieure
+     */
+    explicit SpscQueue(std::size_t capacity)
+        : mask(roundUpPow2(capacity) - 1),
+          items(mask + 1)
+    {
+    }
+
+    SpscQueue(const SpscQueue &) = delete;
+    SpscQueue &operator=(const SpscQueue &) = delete;
+
+    std::size_t capacity() const { return mask + 1; }
+
+    /**
+     * @brief Producteur : ajoute un élément ; false si la file est pleine
+     */
+    bool push(const T &item)
+    {
+        const std::size_t w = writeIndex.load(std::memory_order_relaxed);
+        if (w - cachedRead > mask)
+        {
+            cachedRead = readIndex.load(std::memory_order_acquire);
+            if (w - cachedRead > mask)
+                return false;
+        }
+        items[w & mask] = item;
+        writeIndex.store(w + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Consommateur : plus ancien élément, nullptr si la file est vide
+     *
+     * Le pointeur reste valide jusqu'au pop() suivant.
+     */
+    const T *front()
+    {
+        const std::size_t r = readIndex.load(std::memory_order_relaxed);
+        if (r == cachedWrite)
+        {
+            cachedWrite = writeIndex.load(std::memory_order_acquire);
+            if (r == cachedWrite)
+                return nullptr;
+        }
+        return &items[r & mask];
+    }
+
+    /**
+     * @brief Consommateur : retire l'élément rendu par front() (qui ne doit pas être nullptr)
+     */
+    void pop()
+    {
+        readIndex.store(readIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+private:
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    static std::size_t roundUpPow2(std::size_t n)
+    {
+        std::size_t c = 2;
+        while (c < n)
+            c <<= 1;
+        return c;
+    }
+
+    const std::size_t mask;
+    std::vector<T> items;
+
+    // Producer side
+    alignas(CACHE_LINE) std::atomic<std::size_t> writeIndex{0};
+    std::size_t cachedRead = 0;
+
+    // Consumer side
+    alignas(CACHE_LINE) std::atomic<std::size_t> readIndex{0};
+    std::size_t cachedWrite = 0;
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "Vec2.hpp"
+
+/**
+ * @brief Empreinte FNV-1a 64 bits d'un état de simulation
+ *
+ * Les flottants sont hachés par leurs bits : deux états n'ont la même empreinte
+ * que s'ils sont identiques au bit près (relecture déterministe, non-régression).
+ */
+class StateHash
+{
+public:
+    void addBytes(const void *data, std::size_t size)
+    {
+        const auto *p = static_cast<const unsigned char *>(data);
+        for (std::size_t i = 0; i < size; i++)
+        {
+            h ^= p[i];
+            h *= PRIME;
+        }
+    }
+
+    void add(std::uint64_t v) { addBytes(&v, sizeof(v)); }
+    void add(int v) { add(static_cast<std::uint64_t>(static_cast<std::int64_t>(v))); }
+    void add(bool v) { add(static_cast<std::uint64_t>(v ? 1 : 0)); }
+
+    void add(float f)
+    {
+        std::uint32_t bits = 0;
+        std::memcpy(&bits, &f, sizeof(bits));
+        add(static_cast<std::uint64_t>(bits));
+    }
+
+    void add(const Vec2 &v)
+    {
+        add(v.x);
+        add(v.y);
+    }
+
+    std::uint64_t value() const { return h; }
+
+private:
+    static constexpr std::uint64_t OFFSET = 14695981039346656037ull;
+    static constexpr std::uint64_t PRIME = 1099511628211ull;
+
+    std::uint64_t h = OFFSET;
+};
@@ -0,0 +1,103 @@
+#include "ThreadPool.hpp"
+
+#include "Trace.hpp"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned threads)
+{
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    workers.reserve(threads - 1);
+    for (unsigned i = 1; i < threads; i++)
+        workers.emplace_back([this, i]
+                             { workerLoop(i); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto &t : workers)
+        t.join();
+}
+
+void ThreadPool::parallelFor(std::size_t loopCount, const Body &loopBody)
+{
+    TRACE_SCOPE("ThreadPool::parallelFor");
+
+    if (loopCount == 0)
+        return;
+
+    // Not worth waking anyone for a single index
+    if (workers.empty() || loopCount == 1)
+    {
+        for (std::size_t i = 0; i < loopCount; i++)
+            loopBody(i, 0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        body = &loopBody;
+        count = loopCount;
+        next.store(0, std::memory_order_relaxed);
+        busyWorkers = static_cast<unsigned>(workers.size());
+        generation++;
+    }
+    wake.notify_all();
+
+    runIndices(loopBody, loopCount, 0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this]
+              { return busyWorkers == 0; });
+    body = nullptr;
+}
+
+void ThreadPool::workerLoop(unsigned worker)
+{
+    TRACE_THREAD_NAME("worker");
+
+    std::uint64_t seen = 0;
+    for (;;)
+    {
+        const Body *loopBody = nullptr;
+        std::size_t loopCount = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&]
+                      { return stopping || generation != seen; });
+            if (stopping)
+                return;
+            seen = generation;
+            loopBody = body;
+            loopCount = count;
+        }
+
+        runIndices(*loopBody, loopCount, worker);
+
+        bool last = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            last = --busyWorkers == 0;
+        }
+        if (last)
+            done.notify_one();
+    }
+}
+
+void ThreadPool::runIndices(const Body &loopBody, std::size_t loopCount, unsigned worker)
+{
+    for (;;)
+    {
+        const std::size_t i = next.fetch_add(1, std::memory_order_relaxed);
+        if (i >= loopCount)
+            return;
+        loopBody(i, worker);
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Groupe de threads de calcul persistants, pour des boucles parallèles
+ *
+ * parallelFor(count, body) répartit les indices 0..count-1 entre les threads du
+ * groupe et le thread appelant (distribution dynamique : un compteur atomique, pas
+ * de file par tâche), puis attend la fin de tous les indices. Les threads restent
+ * endormis entre deux appels : pas de création de thread par boucle.
+ *
+ * body(index, worker) : worker est dans 0..size()-1 (0 = thread appelant) et permet
+ * de tenir des accumulateurs par thread sans verrou.
+ */
+class ThreadPool
+{
+public:
+    using Body = std::function<void(std::size_t index, unsigned worker)>;
+
+    /**
+     * @param threads Nombre total de threads, appelant compris (0 = nombre de cœurs)
+     */
+    explicit ThreadPool(unsigned threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    unsigned size() const { return static_cast<unsigned>(workers.size()) + 1; }
+
+    /**
+     * @brief Exécute body pour chaque indice de 0 à count-1 et attend la fin
+     *
+     * Un seul parallelFor à la fois (appel depuis un seul thread).
+     */
+    void parallelFor(std::size_t count, const Body &body);
+
+private:
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable wake; // new loop (or shutdown) for the workers
+    std::condition_variable done; // last worker left the current loop
+
+    // Current loop, published under the mutex
+    const Body *body = nullptr;
+    std::size_t count = 0;
+    std::uint64_t generation = 0;
+    unsigned busyWorkers = 0;
+    bool stopping = false;
+
+    std::atomic<std::size_t> next{0};
+
+    void workerLoop(unsigned worker);
+    void runIndices(const Body &loopBody, std::size_t loopCount, unsigned worker);
+};
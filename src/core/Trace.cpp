@@ -0,0 +1,226 @@
+#include "Trace.hpp"
+
+#if defined(CASSEBRIQUES_TRACING) && CASSEBRIQUES_TRACING
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    constexpr std::uint64_t RING_CAPACITY = 1u << 16; // events kept per thread (power of two)
+
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point epoch = Clock::now();
+
+    // Relaxed atomics: the owning thread is the only writer, the dump may read concurrently
+    struct Event
+    {
+        std::atomic<const char *> name{nullptr};
+        std::atomic<std::uint64_t> stamp{0}; // (nanoseconds since epoch << 1) | isEnd
+    };
+
+    struct ThreadBuffer
+    {
+        std::unique_ptr<Event[]> events{new Event[RING_CAPACITY]};
+        std::atomic<std::uint64_t> head{0}; // total events written (next slot = head % capacity)
+        std::atomic<const char *> name{nullptr};
+        int tid = 0;
+    };
+
+    struct Registry
+    {
+        std::mutex mutex; // only taken when a thread records its first event, and by dumps
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    };
+
+    Registry &registry()
+    {
+        static Registry r;
+        return r;
+    }
+
+    ThreadBuffer &localBuffer()
+    {
+        thread_local ThreadBuffer *buffer = nullptr;
+        if (!buffer)
+        {
+            Registry &r = registry();
+            std::lock_guard<std::mutex> lock(r.mutex);
+            r.buffers.push_back(std::make_unique<ThreadBuffer>());
+            buffer = r.buffers.back().get();
+            buffer->tid = static_cast<int>(r.buffers.size());
+        }
+        return *buffer;
+    }
+
+    void record(const char *name, bool isEnd)
+    {
+        const std::uint64_t ns = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch).count());
+
+        ThreadBuffer &b = localBuffer();
+        const std::uint64_t h = b.head.load(std::memory_order_relaxed);
+        // Pairs with the fence in snapshot(): a dump that reads this event's data also
+        // sees head >= h, so it knows the slot's previous event is being overwritten
+        std::atomic_thread_fence(std::memory_order_release);
+        Event &e = b.events[h & (RING_CAPACITY - 1)];
+        e.name.store(name, std::memory_order_relaxed);
+        e.stamp.store((ns << 1) | (isEnd ? 1u : 0u), std::memory_order_relaxed);
+        b.head.store(h + 1, std::memory_order_release);
+    }
+
+    struct Snapshot
+    {
+        const char *name;
+        std::uint64_t stamp;
+    };
+
+    // Copy of the events still in the ring; entries overwritten during the copy are dropped
+    std::vector<Snapshot> snapshot(const ThreadBuffer &b)
+    {
+        const std::uint64_t h1 = b.head.load(std::memory_order_acquire);
+        const std::uint64_t first = (h1 > RING_CAPACITY) ? h1 - RING_CAPACITY : 0;
+
+        std::vector<Snapshot> out;
+        out.reserve(static_cast<std::size_t>(h1 - first));
+        for (std::uint64_t i = first; i < h1; i++)
+        {
+            const Event &e = b.events[i & (RING_CAPACITY - 1)];
+            out.push_back(Snapshot{e.name.load(std::memory_order_relaxed), e.stamp.load(std::memory_order_relaxed)});
+        }
+
+        // The slot loads above may see data newer than head: order them before reading it again
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const std::uint64_t h2 = b.head.load(std::memory_order_relaxed);
+
+        // Event h2 may be half written over slot h2 - RING_CAPACITY: drop that one too
+        const std::uint64_t valid = (h2 >= RING_CAPACITY) ? h2 - RING_CAPACITY + 1 : 0;
+        if (valid > first)
+            out.erase(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(std::min<std::uint64_t>(valid - first, out.size())));
+        return out;
+    }
+
+    void writeJsonString(std::ostream &os, const char *s)
+    {
+        os << '"';
+        for (; s && *s; s++)
+        {
+            const char c = *s;
+            if (c == '"' || c == '\\')
+                os << '\\' << c;
+            else if (static_cast<unsigned char>(c) < 0x20)
+                os << ' ';
+            else
+                os << c;
+        }
+        os << '"';
+    }
+} // namespace
+
+namespace Trace
+{
+    bool isEnabled()
+    {
+        return true;
+    }
+
+    void begin(const char *name)
+    {
+        record(name, false);
+    }
+
+    void end()
+    {
+        record(nullptr, true);
+    }
+
+    void setThreadName(const char *name)
+    {
+        localBuffer().name.store(name, std::memory_order_relaxed);
+    }
+
+    std::size_t eventCount()
+    {
+        Registry &r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+
+        std::size_t n = 0;
+        for (const auto &b : r.buffers)
+            n += static_cast<std::size_t>(std::min(b->head.load(std::memory_order_acquire), RING_CAPACITY));
+        return n;
+    }
+
+    bool writeChromeJson(const std::string &path)
+    {
+        std::ofstream out(path);
+        if (!out)
+            return false;
+
+        Registry &r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        bool first = true;
+        const auto separator = [&]()
+        {
+            if (!first)
+                out << ",\n";
+            first = false;
+        };
+
+        for (const auto &b : r.buffers)
+        {
+            if (const char *name = b->name.load(std::memory_order_relaxed))
+            {
+                separator();
+                out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << b->tid << ",\"args\":{\"name\":";
+                writeJsonString(out, name);
+                out << "}}";
+            }
+
+            // The ring may have dropped the begin of the oldest scopes: skip their orphan ends
+            int depth = 0;
+            for (const Snapshot &e : snapshot(*b))
+            {
+                const bool isEnd = (e.stamp & 1u) != 0;
+                if (isEnd && depth == 0)
+                    continue;
+                depth += isEnd ? -1 : 1;
+
+                const std::uint64_t ns = e.stamp >> 1;
+                separator();
+                out << "{\"ph\":\"" << (isEnd ? 'E' : 'B') << "\",\"pid\":1,\"tid\":" << b->tid
+                    << ",\"ts\":" << ns / 1000 << '.' << (ns % 1000) / 100 << (ns % 100) / 10 << ns % 10;
+                if (!isEnd)
+                {
+                    out << ",\"name\":";
+                    writeJsonString(out, e.name);
+                }
+                out << '}';
+            }
+        }
+
+        out << "\n]}\n";
+        return static_cast<bool>(out);
+    }
+} // namespace Trace
+
+#else
+
+namespace Trace
+{
+    bool isEnabled() { return false; }
+    void begin(const char *) {}
+    void end() {}
+    void setThreadName(const char *) {}
+    bool writeChromeJson(const std::string &) { return false; }
+    std::size_t eventCount() { return 0; }
+} // namespace Trace
+
+#endif
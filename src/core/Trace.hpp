@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Traçage par portée (profilage), exportable au format Chrome Trace Event
+ *
+ * Activé à la compilation par CASSEBRIQUES_TRACING (option CMake du même nom) ;
+ * sans elle, les macros TRACE_* ne génèrent aucun code.
+ *
+ * Chaque thread écrit ses événements début/fin dans son propre tampon circulaire,
+ * sans verrou ; quand le tampon est plein, les événements les plus anciens sont écrasés.
+ * writeChromeJson() peut être appelé à tout moment depuis n'importe quel thread et
+ * produit un fichier lisible par chrome://tracing, Perfetto ou Speedscope.
+ *
+ * Les noms doivent avoir une durée de vie statique (littéraux de chaîne).
+ */
+namespace Trace
+{
+    /**
+     * @brief true si le traçage est compilé
+     */
+    bool isEnabled();
+
+    /**
+     * @brief Ouvre une portée nommée sur le thread courant
+     */
+    void begin(const char *name);
+
+    /**
+     * @brief Ferme la dernière portée ouverte sur le thread courant
+     */
+    void end();
+
+    /**
+     * @brief Nom du thread courant dans la trace (ex : "main", "sim")
+     */
+    void setThreadName(const char *name);
+
+    /**
+     * @brief Écrit tous les tampons au format Chrome Trace Event (JSON)
+     * @return false si le fichier n'a pas pu être écrit (ou traçage désactivé)
+     */
+    bool writeChromeJson(const std::string &path);
+
+    /**
+     * @brief Nombre d'événements actuellement conservés (tous threads)
+     */
+    std::size_t eventCount();
+
+    /**
+     * @brief Portée RAII : begin() à la construction, end() à la destruction
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(const char *name) { begin(name); }
+        ~Scope() { end(); }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+    };
+} // namespace Trace
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+#if defined(CASSEBRIQUES_TRACING) && CASSEBRIQUES_TRACING
+#define TRACE_SCOPE(name) ::Trace::Scope TRACE_CONCAT(traceScope_, __LINE__)(name)
+#define TRACE_FUNCTION() TRACE_SCOPE(__func__)
+#define TRACE_THREAD_NAME(name) ::Trace::setThreadName(name)
+#else
+#define TRACE_SCOPE(name) ((void)0)
+#define TRACE_FUNCTION() ((void)0)
+#define TRACE_THREAD_NAME(name) ((void)0)
+#endif
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+/**
+ * @brief Triple tampon sans verrou : un producteur publie, un consommateur lit la dernière valeur
+ *
+ * Trois emplacements : celui que le producteur écrit (back), celui que le consommateur
+ * lit (front), et un emplacement intermédiaire échangé atomiquement avec l'un ou
+ * l'autre. Aucun côté n'attend jamais l'autre : le producteur écrase une valeur pas
+ * encore lue, le consommateur relit la même valeur tant qu'aucune n'est publiée.
+ *
+ * Un seul thread appelle back() / publish(), un seul autre appelle update() / front().
+ */
+template <typename T>
+class TripleBuffer
+{
+public:
+    TripleBuffer() = default;
+
+    TripleBuffer(const TripleBuffer &) = delete;
+    TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+    /**
+     * @brief Remplit les trois emplacements avec make() et oublie toute publication
+     *
+     * À appeler quand aucun des deux côtés n'utilise le tampon.
+     */
+    template <typename Make>
+    void reset(Make make)
+    {
+        for (T &slot : slots)
+            slot = make();
+        backIndex = 0;
+        frontIndex = 1;
+        middle.store(2, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Producteur : emplacement à remplir avant publish()
+     */
+    T &back() { return slots[backIndex]; }
+
+    /**
+     * @brief Producteur : rend back() visible au consommateur et reprend un emplacement libre
+     * @return false si la publication précédente n'avait pas été lue (elle est remplacée)
+     */
+    bool publish()
+    {
+        const std::uint8_t previous = middle.exchange(static_cast<std::uint8_t>(backIndex | FRESH), std::memory_order_acq_rel);
+        backIndex = previous & INDEX;
+        return (previous & FRESH) == 0;
+    }
+
+    /**
+     * @brief Consommateur : passe à la dernière publication s'il y en a une
+     * @return true si front() a changé
+     */
+    bool update()
+    {
+        if ((middle.load(std::memory_order_relaxed) & FRESH) == 0)
+            return false;
+
+        const std::uint8_t previous = middle.exchange(static_cast<std::uint8_t>(frontIndex), std::memory_order_acq_rel);
+        frontIndex = previous & INDEX;
+        return true;
+    }
+
+    /**
+     * @brief Consommateur : dernière valeur obtenue par update()
+     */
+    const T &front() const { return slots[frontIndex]; }
+
+private:
+    static constexpr std::uint8_t INDEX = 0x3;
+    static constexpr std::uint8_t FRESH = 0x4; // middle holds a publication not read yet
+
+    std::array<T, 3> slots{};
+    int backIndex = 0;  // producer only
+    int frontIndex = 1; // consumer only
+    std::atomic<std::uint8_t> middle{2};
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+/**
+ * @brief Vecteur 2D minimal (sans dépendance SFML) utilisé par la simulation
+ */
+struct Vec2
+{
+    float x = 0.0f;
+    float y = 0.0f;
+
+    constexpr Vec2() = default;
+    constexpr Vec2(float x, float y) : x(x), y(y) {}
+
+    constexpr Vec2 operator+(const Vec2 &o) const { return Vec2(x + o.x, y + o.y); }
+    constexpr Vec2 operator-(const Vec2 &o) const { return Vec2(x - o.x, y - o.y); }
+    constexpr Vec2 operator-() const { return Vec2(-x, -y); }
+    constexpr Vec2 operator*(float s) const { return Vec2(x * s, y * s); }
+    constexpr Vec2 operator/(float s) const { return Vec2(x / s, y / s); }
+
+    Vec2 &operator+=(const Vec2 &o)
+    {
+        x += o.x;
+        y += o.y;
+        return *this;
+    }
+
+    Vec2 &operator-=(const Vec2 &o)
+    {
+        x -= o.x;
+        y -= o.y;
+        return *this;
+    }
+
+    Vec2 &operator*=(float s)
+    {
+        x *= s;
+        y *= s;
+        return *this;
+    }
+
+    constexpr bool operator==(const Vec2 &o) const { return x == o.x && y == o.y; }
+    constexpr bool operator!=(const Vec2 &o) const { return !(*this == o); }
+};
+
+constexpr Vec2 operator*(float s, const Vec2 &v) { return v * s; }
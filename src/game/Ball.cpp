@@ -6,7 +6,7 @@
 #endif
 
 Ball::Ball(float x, float y, float radius, float screenW, float screenH, float spd)
-    : GameObject(x, y, radius, sf::Color::White), baseSpeed(spd),
+    : GameObject(x, y, radius, Color::White), baseSpeed(spd),
       screenWidth(screenW), screenHeight(screenH)
 {
 }
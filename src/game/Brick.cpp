@@ -3,7 +3,7 @@
 namespace ClassicGame
 {
 
-    Brick::Brick(float x, float y, float width, float height, const sf::Color &col, int pts)
+    Brick::Brick(float x, float y, float width, float height, const Color &col, int pts)
         : GameObject(x, y, width, height, col), points(pts), destroyed(false)
     {
     }
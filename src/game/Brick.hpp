@@ -23,7 +23,7 @@ namespace ClassicGame
          * @param col Couleur
          * @param pts Points donnés
          */
-        Brick(float x, float y, float width, float height, const sf::Color &col, int pts = 10);
+        Brick(float x, float y, float width, float height, const Color &col, int pts = 10);
 
         /**
          * @brief Vérifie si la brique est détruite
@@ -0,0 +1,362 @@
+#include "ClassicSimulation.hpp"
+
+#include "../core/Collision.hpp"
+#include "../core/StateHash.hpp"
+#include "../core/Trace.hpp"
+
+#include <cmath>
+
+namespace
+{
+    // Brick contacts resolved per step before the rest of the motion is left unchecked
+    constexpr int MAX_CONTACTS_PER_STEP = 8;
+
+    // Distance kept between the ball and the face it just touched
+    constexpr float CONTACT_SKIN = 0.01f;
+
+    // Loaded levels: brick area below the HUD, shrunk to fit
+    constexpr float LEVEL_TOP = 80.0f;
+    constexpr float LEVEL_MAX_HEIGHT = 200.0f;
+
+    const Color ROW_COLORS[] = {
+        Color(255, 90, 90),
+        Color(255, 170, 70),
+        Color(255, 230, 90),
+        Color(110, 220, 140),
+        Color(90, 190, 255),
+        Color(180, 140, 255),
+    };
+
+    // Multi-hit bricks (loaded levels) darken a little on every hit they survive
+    Color darken(const Color &c)
+    {
+        return Color(static_cast<std::uint8_t>(c.r * 3 / 4),
+                     static_cast<std::uint8_t>(c.g * 3 / 4),
+                     static_cast<std::uint8_t>(c.b * 3 / 4), c.a);
+    }
+
+    int startingLives(Difficulty d)
+    {
+        switch (d)
+        {
+        case Difficulty::Easy:
+            return 5;
+        case Difficulty::Hard:
+            return 2;
+        case Difficulty::Normal:
+        default:
+            return 3;
+        }
+    }
+
+    float baseBallSpeed(Difficulty d)
+    {
+        switch (d)
+        {
+        case Difficulty::Easy:
+            return 260.0f;
+        case Difficulty::Hard:
+            return 360.0f;
+        case Difficulty::Normal:
+        default:
+            return 300.0f;
+        }
+    }
+
+    float difficultyRamp(Difficulty d)
+    {
+        switch (d)
+        {
+        case Difficulty::Easy:
+            return 1.06f;
+        case Difficulty::Hard:
+            return 1.14f;
+        case Difficulty::Normal:
+        default:
+            return 1.10f;
+        }
+    }
+
+    void reflectBallOnAABB(Ball &ball, const AABB &box)
+    {
+        const Vec2 c = ball.getPosition();
+        const float r = ball.getRadius();
+
+        const float boxCx = (box.left + box.right) * 0.5f;
+        const float boxCy = (box.top + box.bottom) * 0.5f;
+        const float halfW = (box.right - box.left) * 0.5f;
+        const float halfH = (box.bottom - box.top) * 0.5f;
+
+        const float dx = c.x - boxCx;
+        const float dy = c.y - boxCy;
+
+        const float px = (halfW + r) - std::abs(dx);
+        const float py = (halfH + r) - std::abs(dy);
+
+        Vec2 v = ball.getVelocity();
+        if (px < py)
+        {
+            // Hit left/right
+            v.x = -v.x;
+            // Push out slightly to avoid sticking
+            ball.setPosition(c.x + (dx < 0 ? -px : px), c.y);
+        }
+        else
+        {
+            // Hit top/bottom
+            v.y = -v.y;
+            ball.setPosition(c.x, c.y + (dy < 0 ? -py : py));
+        }
+        ball.setVelocity(v);
+    }
+
+} // namespace
+
+ClassicSimulation::ClassicSimulation(Difficulty difficulty, const LevelGrid &level)
+    : difficulty(difficulty),
+      level(level),
+      paddle(FIELD_W / 2.0f - PADDLE_W / 2.0f, FIELD_H - 60.0f, PADDLE_W, PADDLE_H, FIELD_W, 520.0f),
+      ball(FIELD_W / 2.0f, FIELD_H - 100.0f, BALL_R, FIELD_W, FIELD_H, baseBallSpeed(difficulty))
+{
+    resetAll();
+}
+
+void ClassicSimulation::resetAll()
+{
+    lives = startingLives(difficulty);
+    resetLevel();
+}
+
+void ClassicSimulation::resetLevel()
+{
+    bricks.clear();
+    score = 0;
+    rampTimer = 0.0f;
+    ballLaunched = false;
+    state = State::Playing;
+
+    if (level.empty())
+        buildBuiltinGrid();
+    else
+        buildLevelGrid();
+
+    brickGrid.rebuild(bricks.boxes());
+}
+
+void ClassicSimulation::buildBuiltinGrid()
+{
+    const float brickW = 72.0f;
+    const float brickH = 28.0f;
+    const float spacing = 6.0f;
+    const float totalW = BRICK_COLS * brickW + (BRICK_COLS - 1) * spacing;
+    const float startX = (FIELD_W - totalW) / 2.0f;
+    const float startY = 80.0f;
+
+    bricks.reserve(BRICK_ROWS * BRICK_COLS);
+
+    for (int r = 0; r < BRICK_ROWS; r++)
+    {
+        for (int c = 0; c < BRICK_COLS; c++)
+        {
+            const float x = startX + c * (brickW + spacing);
+            const float y = startY + r * (brickH + spacing);
+            const int pts = (BRICK_ROWS - r) * 10;
+            bricks.add(x, y, brickW, brickH, 1, ROW_COLORS[r % 6], pts);
+        }
+    }
+}
+
+void ClassicSimulation::buildLevelGrid()
+{
+    const LevelGrid grid = level.grid();
+    const BrickLayout layout = BrickLayout::fit(grid.rows, grid.cols, FIELD_W, LEVEL_TOP, LEVEL_MAX_HEIGHT);
+
+    bricks.reserve(static_cast<std::size_t>(grid.rows) * grid.cols);
+
+    for (int r = 0; r < grid.rows; r++)
+    {
+        const int pts = (grid.rows - r) * 10;
+        for (int c = 0; c < grid.cols; c++)
+        {
+            const int hp = grid.at(r, c);
+            if (hp > 0)
+                bricks.add(layout.x(c), layout.y(r), layout.brickW, layout.brickH, hp, ROW_COLORS[r % 6], pts);
+        }
+    }
+}
+
+void ClassicSimulation::launchBall()
+{
+    ballLaunched = true;
+    const float spd = baseBallSpeed(difficulty);
+    ball.setVelocity(spd * 0.55f, -spd);
+}
+
+void ClassicSimulation::step(float dt, const ClassicInput &input)
+{
+    TRACE_SCOPE("ClassicSimulation::step");
+
+    if (state != State::Playing)
+        return;
+
+    // Previous state for render interpolation
+    paddle.savePreviousPosition();
+    ball.savePreviousPosition();
+
+    if (input.launch && !ballLaunched)
+        launchBall();
+
+    // Movement
+    paddle.update(dt, input.moveLeft, input.moveRight);
+
+    // Ball behavior
+    if (!ballLaunched)
+    {
+        // Stick ball on paddle (interpolates along with the paddle, no jump from where it was lost)
+        const Vec2 p = paddle.getPosition();
+        const Vec2 prev = paddle.getPreviousPosition();
+        ball.setPosition(p.x + PADDLE_W / 2.0f, p.y - BALL_R - 1.0f);
+        ball.setPreviousPosition(Vec2(prev.x + PADDLE_W / 2.0f, prev.y - BALL_R - 1.0f));
+        return;
+    }
+
+    // Difficulty ramp over time (classic feel)
+    rampTimer += dt;
+    if (rampTimer >= 10.0f)
+    {
+        ball.increaseSpeed(difficultyRamp(difficulty));
+        rampTimer = 0.0f;
+    }
+
+    // Move the ball, bouncing off every brick it meets on the way (time-of-impact order)
+    moveBall(dt);
+
+    // Paddle collision: nudge out to avoid sticking
+    if (ball.checkCollision(paddle))
+    {
+        ball.bounceOnPaddle(paddle.getPosition().x, PADDLE_W);
+        ball.setPosition(ball.getPosition().x, paddle.getPosition().y - BALL_R - 1.0f);
+    }
+
+    // Lose a life
+    if (ball.isLost())
+    {
+        lives--;
+        ballLaunched = false;
+
+        if (lives <= 0)
+        {
+            state = State::Lose;
+        }
+    }
+
+    // Win condition
+    if (bricks.allDestroyed())
+    {
+        state = State::Win;
+    }
+}
+
+void ClassicSimulation::moveBall(float dt)
+{
+    TRACE_SCOPE("ClassicSimulation::moveBall");
+
+    const float r = ball.getRadius();
+    float t = 0.0f; // fraction of the step already simulated
+
+    for (int contacts = 0; contacts < MAX_CONTACTS_PER_STEP; contacts++)
+    {
+        const Vec2 start = ball.getPosition();
+        const Vec2 motion = ball.getVelocity() * ((1.0f - t) * dt);
+
+        const AABB from{start.x - r, start.y - r, start.x + r, start.y + r};
+        const AABB to{from.left + motion.x, from.top + motion.y, from.right + motion.x, from.bottom + motion.y};
+
+        // Earliest contact along the remaining motion
+        int hitBrick = -1;
+        bool overlapping = false;
+        float hitT = 1.0f;
+        Vec2 hitNormal;
+
+        // Gather live candidates from the broadphase, then test them all at once (SIMD narrowphase)
+        narrowphase.clear();
+        narrowphaseBricks.clear();
+        for (const int i : brickGrid.query(SpatialGrid::sweep(from, to)))
+        {
+            if (!bricks.alive[i])
+                continue;
+            narrowphase.add(bricks.x[i], bricks.y[i], bricks.w[i], bricks.h[i]);
+            narrowphaseBricks.push_back(i);
+        }
+
+        if (narrowphase.run(start, r) > 0)
+        {
+            // Already overlapping: first such brick, like the old discrete test
+            for (std::size_t k = 0; k < narrowphaseBricks.size(); k++)
+            {
+                if (narrowphase.hit[k])
+                {
+                    hitBrick = narrowphaseBricks[k];
+                    overlapping = true;
+                    hitT = 0.0f;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            for (const int i : narrowphaseBricks)
+            {
+                float bt = 0.0f;
+                Vec2 n;
+                if (Collision::sweepCircleAABB(start, motion, r, bricks.getAABB(i), bt, n) && (hitBrick < 0 || bt < hitT))
+                {
+                    hitBrick = i;
+                    hitT = bt;
+                    hitNormal = n;
+                }
+            }
+        }
+
+        if (hitBrick < 0)
+            break;
+
+        // Advance to the contact and bounce
+        ball.setPosition(start + motion * hitT);
+        t += hitT * (1.0f - t);
+
+        if (overlapping)
+        {
+            // Already inside (should not happen with swept tests): reflect by contact side
+            reflectBallOnAABB(ball, bricks.getAABB(hitBrick));
+        }
+        else
+        {
+            ball.setVelocity(Collision::reflect(ball.getVelocity(), hitNormal));
+            ball.setPosition(ball.getPosition() + hitNormal * CONTACT_SKIN);
+        }
+
+        if (bricks.damage(hitBrick, 1))
+            score += bricks.points[hitBrick];
+        else
+            bricks.color[hitBrick] = darken(bricks.color[hitBrick]);
+    }
+
+    // Rest of the step (walls are handled by Ball::update)
+    ball.update((1.0f - t) * dt);
+}
+
+std::uint64_t ClassicSimulation::stateHash() const
+{
+    StateHash h;
+    h.add(static_cast<int>(state));
+    h.add(score);
+    h.add(lives);
+    h.add(ballLaunched);
+    h.add(rampTimer);
+    h.add(paddle.getPosition());
+    h.add(ball.getPosition());
+    h.add(ball.getVelocity());
+    bricks.hashInto(h);
+    return h.value();
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "../core/BrickField.hpp"
+#include "../core/CollisionBatch.hpp"
+#include "../core/Difficulty.hpp"
+#include "../core/SpatialGrid.hpp"
+#include "../level/Level.hpp"
+#include "Ball.hpp"
+#include "Paddle.hpp"
+
+/**
+ * @brief Entrées d'un pas de simulation (version classique)
+ */
+struct ClassicInput
+{
+    bool moveLeft = false;
+    bool moveRight = false;
+    bool launch = false; // front montant : lance la balle si elle est sur la raquette
+};
+
+/**
+ * @brief Règles du casse-briques classique, sans fenêtre ni dépendance SFML
+ *
+ * Contient raquette, balle, briques, score, vies et conditions de victoire/défaite.
+ * La scène (src/scenes/ClassicGameScene.cpp) ne fait que traduire les entrées et dessiner l'état.
+ */
+class ClassicSimulation
+{
+public:
+    enum class State
+    {
+        Playing,
+        Win,
+        Lose,
+    };
+
+    static constexpr float FIELD_W = 800.0f;
+    static constexpr float FIELD_H = 600.0f;
+
+    static constexpr float PADDLE_W = 110.0f;
+    static constexpr float PADDLE_H = 20.0f;
+    static constexpr float BALL_R = 8.0f;
+
+    static constexpr int BRICK_ROWS = 6;
+    static constexpr int BRICK_COLS = 10;
+
+    /**
+     * @param level Grille du niveau (vide : grille intégrée BRICK_ROWS x BRICK_COLS, 1 PV)
+     */
+    explicit ClassicSimulation(Difficulty difficulty, const LevelGrid &level = LevelGrid());
+
+    /**
+     * @brief Recommence une partie complète (vies + niveau)
+     */
+    void resetAll();
+
+    /**
+     * @brief Avance la simulation d'un pas
+     *
+     * Les positions précédentes sont mémorisées au début du pas pour l'interpolation du rendu.
+     * @param dt Durée du pas (en secondes)
+     * @param input Entrées du joueur pour ce pas
+     */
+    void step(float dt, const ClassicInput &input);
+
+    State getState() const { return state; }
+    int getScore() const { return score; }
+    int getLives() const { return lives; }
+    bool isBallLaunched() const { return ballLaunched; }
+    Difficulty getDifficulty() const { return difficulty; }
+    LevelGrid getLevel() const { return level.grid(); }
+
+    const Paddle &getPaddle() const { return paddle; }
+    const Ball &getBall() const { return ball; }
+    const BrickField &getBricks() const { return bricks; }
+
+    /**
+     * @brief Empreinte de l'état de jeu complet (voir StateHash)
+     *
+     * Deux parties rejouées avec les mêmes entrées doivent donner la même empreinte.
+     */
+    std::uint64_t stateHash() const;
+
+private:
+    Difficulty difficulty;
+    Level level; // copied: the simulation does not depend on the caller's storage
+
+    Paddle paddle;
+    Ball ball;
+    BrickField bricks;
+    SpatialGrid brickGrid; // broadphase over bricks (indices into bricks)
+
+    Collision::CircleRectBatch narrowphase; // gathered candidate bricks (scratch)
+    std::vector<int> narrowphaseBricks;     // brick index of each narrowphase entry
+
+    int score = 0;
+    int lives = 3;
+    bool ballLaunched = false;
+    float rampTimer = 0.0f;
+    State state = State::Playing;
+
+    void resetLevel();
+    void buildBuiltinGrid();
+    void buildLevelGrid();
+    void launchBall();
+    void moveBall(float dt);
+};
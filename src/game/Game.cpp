@@ -35,8 +35,6 @@ Game::Game()
     }
     #endif
     // Si aucune police n'est chargée, le texte ne s'affichera pas mais le jeu continuera
-    
-    window.setFramerateLimit(60);
 }
 
 void Game::init()
@@ -54,6 +52,8 @@ void Game::run()
 
     while (window.isOpen())
     {
+        pacer.wait();
+
         sf::Event event;
         while (window.pollEvent(event))
         {
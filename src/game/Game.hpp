@@ -2,6 +2,7 @@
 
 #include <SFML/Graphics.hpp>
 #include <vector>
+#include "../core/FramePacer.hpp"
 #include "../core/InputManager.hpp"
 #include "Paddle.hpp"
 #include "Ball.hpp"
@@ -16,6 +17,7 @@ private:
     // Fenêtre SFML
     sf::RenderWindow window;
     sf::Clock clock;
+    FramePacer pacer; // 60 fps
 
     // Gestionnaire d'entrées
     InputManager inputManager;
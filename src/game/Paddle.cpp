@@ -2,7 +2,7 @@
 #include <algorithm>
 
 Paddle::Paddle(float x, float y, float width, float height, float screenW, float spd)
-    : GameObject(x, y, width, height, sf::Color::White), speed(spd), screenWidth(screenW)
+    : GameObject(x, y, width, height, Color::White), speed(spd), screenWidth(screenW)
 {
 }
 
@@ -4,7 +4,7 @@ namespace RebornGame
 {
 
     Brick::Brick(float x, float y, float width, float height, int hp)
-        : GameObject(x, y, width, height, sf::Color::Red),
+        : GameObject(x, y, width, height, Color::Red),
           maxHP(hp), currentHP(hp), destroyed(false)
     {
         updateColor();
@@ -41,21 +41,26 @@ namespace RebornGame
     }
 
     void Brick::updateColor()
+    {
+        color = colorForHP(currentHP, maxHP);
+    }
+
+    Color Brick::colorForHP(int hp, int maxHP)
     {
         // Changer la couleur selon les HP restants
-        float hpRatio = static_cast<float>(currentHP) / static_cast<float>(maxHP);
+        float hpRatio = static_cast<float>(hp) / static_cast<float>(maxHP);
 
         if (hpRatio > 0.66f)
         {
-            color = sf::Color::Red; // 3 HP ou plus
+            return Color::Red; // 3 HP ou plus
         }
         else if (hpRatio > 0.33f)
         {
-            color = sf::Color::Yellow; // 2 HP
+            return Color::Yellow; // 2 HP
         }
         else
         {
-            color = sf::Color::Green; // 1 HP
+            return Color::Green; // 1 HP
         }
     }
 
@@ -50,6 +50,11 @@ namespace RebornGame
          * @brief Met à jour la couleur selon les HP restants
          */
         void updateColor();
+
+        /**
+         * @brief Couleur correspondant à un ratio de HP (aussi utilisée par BrickField)
+         */
+        static Color colorForHP(int hp, int maxHP);
     };
 } // namespace RebornGame
 
@@ -6,11 +6,11 @@
 #endif
 
 Cannon::Cannon(float screenW, float screenH)
-    : GameObject(screenW / 2.0f, screenH - 80.0f, 40.0f, 60.0f, sf::Color::White),
+    : GameObject(screenW / 2.0f, screenH - 80.0f, 40.0f, 60.0f, Color::White),
       screenWidth(screenW), screenHeight(screenH)
 {
     // Origine au centre du bas pour la rotation
-    // Note: GameObject ne gère pas l'origine, on devra le gérer dans draw()
+    // Note: GameObject ne gère pas l'origine, c'est Render::ShapeBatch::addCannon() qui la place
 }
 
 void Cannon::pointAt(float mouseX, float mouseY)
@@ -39,19 +39,3 @@ float Cannon::getDirectionRadians() const
 {
     return rotation * static_cast<float>(M_PI) / 180.0f;
 }
-
-void Cannon::draw(sf::RenderWindow &window)
-{
-    // Dessiner un rectangle pour le canon
-    sf::RectangleShape rect(size);
-
-    // Origine au centre du bas pour que la rotation soit autour de la base
-    rect.setOrigin(size.x / 2.0f, size.y);
-
-    // Position et rotation
-    rect.setPosition(position);
-    rect.setRotation(rotation);
-    rect.setFillColor(color);
-
-    window.draw(rect);
-}
@@ -30,11 +30,5 @@ public:
      * @brief Retourne la direction du canon en radians
      */
     float getDirectionRadians() const;
-
-    /**
-     * @brief Dessine le canon avec rotation correcte
-     * @param window Fenêtre SFML où dessiner
-     */
-    void draw(sf::RenderWindow &window) override;
 };
 
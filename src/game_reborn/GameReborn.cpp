@@ -30,8 +30,6 @@ GameReborn::GameReborn()
     }
     #endif
     // Si aucune police n'est chargée, le texte ne s'affichera pas mais le jeu continuera
-    
-    window.setFramerateLimit(60);
 }
 
 void GameReborn::init()
@@ -45,6 +43,8 @@ void GameReborn::run()
 
     while (window.isOpen())
     {
+        pacer.wait();
+
         sf::Event event;
         while (window.pollEvent(event))
         {
@@ -7,17 +7,17 @@
 
 namespace
 {
-    sf::Color colorForShot(Projectile::ShotType t)
+    Color colorForShot(Projectile::ShotType t)
     {
         switch (t)
         {
         case Projectile::ShotType::Piercing:
-            return sf::Color(255, 80, 255); // magenta
+            return Color(255, 80, 255); // magenta
         case Projectile::ShotType::Explosive:
-            return sf::Color(255, 160, 40); // orange
+            return Color(255, 160, 40); // orange
         case Projectile::ShotType::Normal:
         default:
-            return sf::Color::Cyan;
+            return Color::Cyan;
         }
     }
 } // namespace
@@ -123,3 +123,13 @@ void Projectile::markHit()
 {
     hitSomething = true;
 }
+
+int Projectile::getPiercedBrick() const
+{
+    return piercedBrick;
+}
+
+void Projectile::setPiercedBrick(int brickIndex)
+{
+    piercedBrick = brickIndex;
+}
@@ -25,6 +25,7 @@ private:
 
     bool dead = false;
     bool hitSomething = false;
+    int piercedBrick = -1; // brique en cours de traversée (ignorée par les collisions)
 
 public:
     /**
@@ -59,5 +60,8 @@ public:
 
     bool hasHitSomething() const;
     void markHit();
+
+    int getPiercedBrick() const;
+    void setPiercedBrick(int brickIndex);
 };
 
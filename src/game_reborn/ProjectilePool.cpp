@@ -0,0 +1,63 @@
+#include "ProjectilePool.hpp"
+
+#include <algorithm>
+
+ProjectilePool::ProjectilePool(int capacity)
+{
+    setCapacity(capacity);
+}
+
+void ProjectilePool::setCapacity(int capacity)
+{
+    capacity = std::max(0, capacity);
+    if (capacity != getCapacity())
+    {
+        // Placeholder projectiles: every slot is overwritten by spawn() before use
+        slots.assign(capacity, Projectile(0.0f, 0.0f, 0.0f, 0.0f, 0.0f));
+        generations.assign(capacity, 0);
+        freeSlots.reserve(capacity);
+        live.reserve(capacity);
+    }
+    clear();
+}
+
+void ProjectilePool::clear()
+{
+    for (const int slot : live)
+        generations[slot]++;
+    live.clear();
+
+    // Lowest slots handed out first
+    freeSlots.clear();
+    for (int slot = getCapacity() - 1; slot >= 0; slot--)
+        freeSlots.push_back(slot);
+}
+
+void ProjectilePool::release(Handle handle)
+{
+    if (!get(handle))
+        return;
+
+    live.erase(std::find(live.begin(), live.end(), handle.slot));
+    freeSlot(handle.slot);
+}
+
+Projectile *ProjectilePool::get(Handle handle)
+{
+    const ProjectilePool &self = *this;
+    return const_cast<Projectile *>(self.get(handle));
+}
+
+const Projectile *ProjectilePool::get(Handle handle) const
+{
+    // Freed slots bump their generation, so a matching generation means "still alive"
+    if (handle.slot < 0 || handle.slot >= getCapacity() || generations[handle.slot] != handle.generation)
+        return nullptr;
+    return &slots[handle.slot];
+}
+
+void ProjectilePool::freeSlot(int slot)
+{
+    generations[slot]++;
+    freeSlots.push_back(slot);
+}
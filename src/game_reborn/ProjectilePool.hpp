@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Projectile.hpp"
+
+/**
+ * @brief Réserve de projectiles à capacité fixe (aucune allocation en jeu)
+ *
+ * Les emplacements sont alloués une seule fois (setCapacity) puis recyclés par
+ * une liste libre : tirer ou retirer un projectile ne touche jamais au tas et ne
+ * déplace aucun autre projectile. Un Handle (indice + génération) reste valide
+ * tant que son projectile est vivant, et devient invalide dès qu'il est libéré.
+ *
+ * Le parcours (begin/end, liveSlots) ne visite que les emplacements vivants,
+ * dans l'ordre de tir.
+ */
+class ProjectilePool
+{
+public:
+    struct Handle
+    {
+        int slot = -1;
+        std::uint32_t generation = 0;
+
+        bool isValid() const { return slot >= 0; }
+    };
+
+    explicit ProjectilePool(int capacity = 0);
+
+    /**
+     * @brief Fixe le nombre d'emplacements ; ne réalloue que si la capacité change
+     *
+     * Vide la réserve (tous les handles existants deviennent invalides).
+     */
+    void setCapacity(int capacity);
+
+    /**
+     * @brief Libère tous les projectiles, sans libérer la mémoire
+     */
+    void clear();
+
+    /**
+     * @brief Construit un projectile dans un emplacement libre
+     * @return Handle invalide si la réserve est pleine
+     */
+    template <typename... Args>
+    Handle spawn(Args &&...args)
+    {
+        if (freeSlots.empty())
+            return Handle{};
+
+        const int slot = freeSlots.back();
+        freeSlots.pop_back();
+        slots[slot] = Projectile(std::forward<Args>(args)...);
+        live.push_back(slot);
+        return Handle{slot, generations[slot]};
+    }
+
+    /**
+     * @brief Libère le projectile désigné (sans effet si le handle est périmé)
+     */
+    void release(Handle handle);
+
+    /**
+     * @brief Libère tous les projectiles pour lesquels pred(projectile) est vrai
+     *
+     * L'ordre de tir des projectiles restants est conservé.
+     */
+    template <typename Pred>
+    void releaseIf(Pred pred)
+    {
+        std::size_t kept = 0;
+        for (std::size_t k = 0; k < live.size(); k++)
+        {
+            const int slot = live[k];
+            if (pred(slots[slot]))
+                freeSlot(slot);
+            else
+                live[kept++] = slot;
+        }
+        live.resize(kept);
+    }
+
+    /**
+     * @brief Projectile désigné par un handle, ou nullptr s'il a été libéré
+     */
+    Projectile *get(Handle handle);
+    const Projectile *get(Handle handle) const;
+
+    /**
+     * @brief Handle du projectile vivant à la position k du parcours
+     */
+    Handle handleAt(std::size_t k) const { return Handle{live[k], generations[live[k]]}; }
+
+    // Accès direct par emplacement (indices donnés par liveSlots)
+    Projectile &operator[](int slot) { return slots[slot]; }
+    const Projectile &operator[](int slot) const { return slots[slot]; }
+
+    /**
+     * @brief Emplacements vivants, dans l'ordre de tir
+     */
+    const std::vector<int> &liveSlots() const { return live; }
+
+    std::size_t size() const { return live.size(); }
+    bool empty() const { return live.empty(); }
+    bool full() const { return freeSlots.empty(); }
+    int getCapacity() const { return static_cast<int>(slots.size()); }
+
+    // Parcours des projectiles vivants (range-for)
+    class const_iterator
+    {
+    public:
+        const_iterator(const ProjectilePool *pool, std::size_t k) : pool(pool), k(k) {}
+
+        const Projectile &operator*() const { return pool->slots[pool->live[k]]; }
+        const Projectile *operator->() const { return &**this; }
+        const_iterator &operator++()
+        {
+            ++k;
+            return *this;
+        }
+        bool operator!=(const const_iterator &other) const { return k != other.k; }
+        bool operator==(const const_iterator &other) const { return k == other.k; }
+
+    private:
+        const ProjectilePool *pool;
+        std::size_t k;
+    };
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, live.size()); }
+
+private:
+    std::vector<Projectile> slots;
+    std::vector<std::uint32_t> generations; // incrémentée à chaque libération
+    std::vector<int> freeSlots;             // pile des emplacements libres
+    std::vector<int> live;                  // emplacements vivants, ordre de tir
+
+    void freeSlot(int slot);
+};
@@ -0,0 +1,675 @@
+#include "RebornSimulation.hpp"
+
+#include "../core/Collision.hpp"
+#include "../core/StateHash.hpp"
+#include "../core/Trace.hpp"
+#include "Brick.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    int projectileBudget(Difficulty d)
+    {
+        switch (d)
+        {
+        case Difficulty::Easy:
+            return 70;
+        case Difficulty::Hard:
+            return 35;
+        case Difficulty::Normal:
+        default:
+            return 50;
+        }
+    }
+
+    float projectileSpeed(Difficulty d)
+    {
+        switch (d)
+        {
+        case Difficulty::Easy:
+            return 460.0f;
+        case Difficulty::Hard:
+            return 560.0f;
+        case Difficulty::Normal:
+        default:
+            return 500.0f;
+        }
+    }
+
+    int brickHpForRow(Difficulty d, int rowFromTop)
+    {
+        // rowFromTop: 0..rows-1, top row hardest
+        int base = 1 + (RebornSimulation::BRICK_ROWS - 1 - rowFromTop) / 2; // 1..3-ish
+        if (d == Difficulty::Easy)
+            base = std::max(1, base - 1);
+        if (d == Difficulty::Hard)
+            base = std::min(4, base + 1);
+        return std::max(1, std::min(4, base));
+    }
+
+    int levelBrickHp(Difficulty d, int fileHp)
+    {
+        // Level files give Normal hit points
+        if (d == Difficulty::Easy)
+            return std::max(1, fileHp - 1);
+        if (d == Difficulty::Hard)
+            return std::min(255, fileHp + 1);
+        return fileHp;
+    }
+
+    // Endless rows: one cell in ENDLESS_GAP_ONE_IN is left empty, and the hit points
+    // range grows by one every ENDLESS_ROWS_PER_HP rows (1 to 4 HP at Normal)
+    constexpr std::uint32_t ENDLESS_GAP_ONE_IN = 10;
+    constexpr int ENDLESS_ROWS_PER_HP = 12;
+    constexpr int ENDLESS_MAX_HP = 4;
+    constexpr int ENDLESS_AMMO_PER_BRICK = 1; // refunded per destroyed brick
+
+    std::uint32_t cellHash(std::uint32_t seed, int row, int col)
+    {
+        // splitmix64 finalizer: every (seed, row, col) gets an independent value
+        std::uint64_t z = (static_cast<std::uint64_t>(seed) << 32) ^
+                          (static_cast<std::uint64_t>(static_cast<std::uint32_t>(row)) << 8) ^
+                          static_cast<std::uint64_t>(static_cast<std::uint32_t>(col));
+        z += 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return static_cast<std::uint32_t>(z ^ (z >> 31));
+    }
+
+    int endlessBrickHp(Difficulty d, std::uint32_t seed, int row, int col)
+    {
+        const std::uint32_t h = cellHash(seed, row, col);
+        if (h % ENDLESS_GAP_ONE_IN == 0)
+            return 0;
+        const int maxHp = std::min(ENDLESS_MAX_HP, 1 + row / ENDLESS_ROWS_PER_HP);
+        return levelBrickHp(d, 1 + static_cast<int>((h >> 8) % static_cast<std::uint32_t>(maxHp)));
+    }
+
+    int maxActiveShots(Difficulty d)
+    {
+        switch (d)
+        {
+        case Difficulty::Easy:
+            return 5;
+        case Difficulty::Hard:
+            return 3;
+        case Difficulty::Normal:
+        default:
+            return 4;
+        }
+    }
+
+    float fireCooldownSeconds(Difficulty d)
+    {
+        switch (d)
+        {
+        case Difficulty::Easy:
+            return 0.18f;
+        case Difficulty::Hard:
+            return 0.28f;
+        case Difficulty::Normal:
+        default:
+            return 0.22f;
+        }
+    }
+
+    float brickDescendSpeed(Difficulty d)
+    {
+        switch (d)
+        {
+        case Difficulty::Easy:
+            return 8.0f;
+        case Difficulty::Hard:
+            return 14.0f;
+        case Difficulty::Normal:
+        default:
+            return 11.0f;
+        }
+    }
+
+    int shotCost(Projectile::ShotType t)
+    {
+        switch (t)
+        {
+        case Projectile::ShotType::Piercing:
+            return 2;
+        case Projectile::ShotType::Explosive:
+            return 3;
+        case Projectile::ShotType::Normal:
+        default:
+            return 1;
+        }
+    }
+
+    // Contacts resolved per projectile and per step before the rest of the motion is left unchecked
+    constexpr int MAX_CONTACTS_PER_STEP = 8;
+
+    // Distance kept between a projectile and the face it just touched
+    constexpr float CONTACT_SKIN = 0.01f;
+
+    bool laterContact(float ta, int pa, int ba, float tb, int pb, int bb)
+    {
+        if (ta != tb)
+            return ta > tb;
+        if (pa != pb)
+            return pa > pb;
+        return ba > bb;
+    }
+
+} // namespace
+
+RebornSimulation::RebornSimulation(Difficulty difficulty, const LevelGrid &level, Mode mode, std::uint32_t seed)
+    : difficulty(difficulty),
+      level(level),
+      mode(mode),
+      seed(seed),
+      cannon(FIELD_W, FIELD_H)
+{
+    resetAll();
+}
+
+void RebornSimulation::resetAll()
+{
+    budget = projectileBudget(difficulty);
+    resetLevel();
+}
+
+void RebornSimulation::resetLevel()
+{
+    bricks.clear();
+    score = 0;
+    used = 0;
+    combo = 0;
+    fireCooldown = 0.0f;
+    state = State::Playing;
+    loseReason = LoseReason::OutOfAmmo;
+    currentShot = Projectile::ShotType::Normal;
+    maxActive = maxActiveShots(difficulty);
+    projectiles.setCapacity(maxActive);
+    projectileTime.reserve(maxActive);
+    projectileContacts.reserve(maxActive);
+    contactQueue.reserve(maxActive);
+    dangerLineY = FIELD_H - 150.0f;
+    lastDescend = 0.0f;
+    streamedRows = 0;
+
+    if (level.empty())
+        buildBuiltinGrid();
+    else
+        buildLevelGrid();
+
+    if (mode == Mode::Endless)
+    {
+        // Rows alive at once: from just above the screen down to the danger line.
+        // All slots are reserved now; a long session never grows the field.
+        const float pitch = streamLayout.brickH + streamLayout.spacing;
+        const std::size_t liveRows = static_cast<std::size_t>(std::ceil((dangerLineY + pitch) / pitch)) + 1;
+        slotCapacity = std::max(bricks.size(), liveRows * static_cast<std::size_t>(streamCols));
+        bricks.reserve(slotCapacity);
+        brickBoxes.reserve(slotCapacity);
+        freeSlots.reserve(streamCols);
+        rowHp.assign(streamCols, 0);
+        streamRows();
+    }
+
+    brickGrid.rebuild(bricks.boxes());
+}
+
+void RebornSimulation::buildBuiltinGrid()
+{
+    const float brickW = 72.0f;
+    const float brickH = 28.0f;
+    const float spacing = 6.0f;
+    const float totalW = BRICK_COLS * brickW + (BRICK_COLS - 1) * spacing;
+    const float startX = (FIELD_W - totalW) / 2.0f;
+    const float startY = 80.0f;
+
+    bricks.reserve(BRICK_ROWS * BRICK_COLS);
+    streamLayout = BrickLayout{startX, startY, brickW, brickH, spacing};
+    streamCols = BRICK_COLS;
+    topRowY = startY;
+
+    for (int r = 0; r < BRICK_ROWS; r++)
+    {
+        for (int c = 0; c < BRICK_COLS; c++)
+        {
+            const float x = startX + c * (brickW + spacing);
+            const float y = startY + r * (brickH + spacing);
+
+            const int hp = brickHpForRow(difficulty, r);
+            bricks.add(x, y, brickW, brickH, hp, RebornGame::Brick::colorForHP(hp, hp));
+        }
+    }
+}
+
+void RebornSimulation::buildLevelGrid()
+{
+    const LevelGrid grid = level.grid();
+    BrickLayout layout = BrickLayout::fit(grid.rows, grid.cols, FIELD_W, 80.0f, 0.0f);
+
+    // Bottom row where the built-in grid ends; taller levels start above the screen
+    if (grid.rows > BRICK_ROWS)
+        layout.startY -= (grid.rows - BRICK_ROWS) * (layout.brickH + layout.spacing);
+
+    bricks.reserve(static_cast<std::size_t>(grid.rows) * grid.cols);
+    streamLayout = layout;
+    streamCols = grid.cols;
+    topRowY = layout.startY;
+
+    for (int r = 0; r < grid.rows; r++)
+    {
+        for (int c = 0; c < grid.cols; c++)
+        {
+            if (grid.at(r, c) == 0)
+                continue;
+            const int hp = levelBrickHp(difficulty, grid.at(r, c));
+            bricks.add(layout.x(c), layout.y(r), layout.brickW, layout.brickH, hp, RebornGame::Brick::colorForHP(hp, hp));
+        }
+    }
+}
+
+void RebornSimulation::streamRows()
+{
+    const float pitch = streamLayout.brickH + streamLayout.spacing;
+    bool spawned = false;
+
+    // A new row as soon as the top one is fully on screen: rows slide in from above
+    while (topRowY > 0.0f)
+    {
+        int count = 0;
+        for (int c = 0; c < streamCols; c++)
+        {
+            rowHp[c] = endlessBrickHp(difficulty, seed, streamedRows, c);
+            count += (rowHp[c] > 0) ? 1 : 0;
+        }
+
+        // Destroyed bricks' slots first, then the never used ones
+        freeSlots.clear();
+        for (std::size_t i = 0; i < bricks.size() && static_cast<int>(freeSlots.size()) < count; i++)
+        {
+            if (!bricks.alive[i])
+                freeSlots.push_back(static_cast<int>(i));
+        }
+        if (freeSlots.size() + (slotCapacity - bricks.size()) < static_cast<std::size_t>(count))
+            break; // not reachable with slotCapacity, kept as a guard
+
+        const float rowY = topRowY - pitch;
+        std::size_t k = 0;
+        for (int c = 0; c < streamCols; c++)
+        {
+            const int hp = rowHp[c];
+            if (hp == 0)
+                continue;
+            const Color color = RebornGame::Brick::colorForHP(hp, hp);
+            if (k < freeSlots.size())
+                bricks.respawn(freeSlots[k++], streamLayout.x(c), rowY, streamLayout.brickW, streamLayout.brickH, hp, color);
+            else
+                bricks.add(streamLayout.x(c), rowY, streamLayout.brickW, streamLayout.brickH, hp, color);
+        }
+
+        topRowY = rowY;
+        streamedRows++;
+        spawned = true;
+    }
+
+    if (!spawned)
+        return;
+
+    // Destroyed slots would otherwise keep descending with the field forever, stretching
+    // the broadphase (and the render cache) bounds: park them on the new top row
+    for (std::size_t i = 0; i < bricks.size(); i++)
+    {
+        if (!bricks.alive[i])
+        {
+            bricks.x[i] = streamLayout.startX;
+            bricks.y[i] = topRowY;
+        }
+    }
+
+    bricks.boxes(brickBoxes);
+    brickGrid.rebuild(brickBoxes);
+}
+
+void RebornSimulation::fire(Projectile::ShotType type, float angle)
+{
+    const Vec2 pos = cannon.getPosition();
+    const float speed = projectileSpeed(difficulty);
+
+    const float offset = 34.0f;
+    const float ox = offset * std::cos(angle);
+    const float oy = offset * std::sin(angle);
+
+    projectiles.spawn(pos.x + ox, pos.y + oy, angle, FIELD_W, FIELD_H, speed, type);
+}
+
+float RebornSimulation::lowestBrickBottom() const
+{
+    return bricks.lowestAliveBottom();
+}
+
+void RebornSimulation::step(float dt, const RebornInput &input)
+{
+    TRACE_SCOPE("RebornSimulation::step");
+
+    if (state != State::Playing)
+        return;
+
+    // Previous state for render interpolation
+    for (const int slot : projectiles.liveSlots())
+        projectiles[slot].savePreviousPosition();
+
+    if (input.selectShot)
+        currentShot = input.shot;
+
+    // Aim cannon
+    cannon.pointAt(input.aim.x, input.aim.y);
+
+    // Fire cooldown
+    if (fireCooldown > 0.0f)
+        fireCooldown = std::max(0.0f, fireCooldown - dt);
+
+    // Fire (multi-shot, arcade feel)
+    const int cost = shotCost(currentShot);
+    float newShotTime = 0.0f; // fraction of the step the new projectile does not travel
+    if (input.fireHeld && fireCooldown <= 0.0f && !projectiles.full() && used + cost <= budget)
+    {
+        // A press timed inside the step leaves at that instant, along the aim of that instant
+        if (input.fireAt > 0.0f)
+        {
+            Cannon pressed = cannon;
+            pressed.pointAt(input.fireAim.x, input.fireAim.y);
+            fire(currentShot, pressed.getDirectionRadians());
+            newShotTime = std::min(input.fireAt, 1.0f);
+        }
+        else
+        {
+            fire(currentShot, cannon.getDirectionRadians());
+        }
+        used += cost;
+        fireCooldown = fireCooldownSeconds(difficulty);
+    }
+
+    // Bricks descend (pressure): the whole field translates as a block
+    lastDescend = brickDescendSpeed(difficulty) * dt;
+    bricks.translateY(lastDescend);
+    brickGrid.translate(0.0f, lastDescend);
+    topRowY += lastDescend;
+
+    // Danger line lose condition
+    if (bricks.lowestAliveBottom() >= dangerLineY)
+    {
+        state = State::Lose;
+        loseReason = LoseReason::DangerLine;
+        return;
+    }
+
+    if (mode == Mode::Endless)
+        streamRows();
+
+    // Move projectiles, resolving brick contacts in time-of-impact order
+    moveProjectiles(dt, newShotTime);
+
+    // Remove lost/dead projectiles (also update miss penalty)
+    projectiles.releaseIf([this](const Projectile &p)
+                          {
+                              if (p.isLost() || p.isDead())
+                              {
+                                  if (!p.hasHitSomething())
+                                      combo = 0;
+                                  return true;
+                              }
+                              return false;
+                          });
+
+    // Win condition (none in endless mode: the next rows are on their way)
+    if (mode == Mode::Standard && bricks.allDestroyed())
+    {
+        state = State::Win;
+        return;
+    }
+
+    // Lose condition: no budget remaining and nothing active
+    if (used >= budget && projectiles.empty())
+    {
+        state = State::Lose;
+        loseReason = LoseReason::OutOfAmmo;
+    }
+}
+
+bool RebornSimulation::findContact(int projectileIndex, float dt, Contact &out)
+{
+    Projectile &p = projectiles[projectiles.liveSlots()[projectileIndex]];
+    const float t0 = projectileTime[projectileIndex];
+    const Vec2 start = p.getPosition();
+    const Vec2 v = p.getVelocity();
+    const Vec2 motion = v * ((1.0f - t0) * dt);
+    const float r = p.getRadius();
+
+    // Left the brick it was piercing: it can be hit again
+    const int pierced = p.getPiercedBrick();
+    if (pierced >= 0 && !p.checkCollision(bricks.getAABB(pierced)))
+        p.setPiercedBrick(-1);
+
+    const AABB from{start.x - r, start.y - r, start.x + r, start.y + r};
+    const AABB to{from.left + motion.x, from.top + motion.y, from.right + motion.x, from.bottom + motion.y};
+
+    // Gather live candidates from the broadphase, then test them all at once (SIMD narrowphase)
+    narrowphase.clear();
+    narrowphaseBricks.clear();
+    for (const int i : brickGrid.query(SpatialGrid::sweep(from, to)))
+    {
+        if (!bricks.alive[i] || i == p.getPiercedBrick())
+            continue;
+        narrowphase.add(bricks.x[i], bricks.y[i], bricks.w[i], bricks.h[i]);
+        narrowphaseBricks.push_back(i);
+    }
+    narrowphase.run(start, r);
+
+    bool found = false;
+    for (std::size_t k = 0; k < narrowphaseBricks.size(); k++)
+    {
+        const int i = narrowphaseBricks[k];
+
+        // Already overlapping (e.g. the field descended onto the projectile): contact now,
+        // unless the projectile is already moving out of the brick
+        if (narrowphase.hit[k])
+        {
+            const Vec2 n(narrowphase.nx[k], narrowphase.ny[k]);
+            if (v.x * n.x + v.y * n.y >= 0.0f)
+                continue;
+            if (!found || t0 < out.t)
+            {
+                out = Contact{t0, projectileIndex, i, n, narrowphase.pen[k]};
+                found = true;
+            }
+            continue;
+        }
+
+        float t = 0.0f;
+        Vec2 n;
+        if (Collision::sweepCircleAABB(start, motion, r, bricks.getAABB(i), t, n))
+        {
+            const float at = t0 + t * (1.0f - t0);
+            if (!found || at < out.t)
+            {
+                out = Contact{at, projectileIndex, i, n, 0.0f};
+                found = true;
+            }
+        }
+    }
+    return found;
+}
+
+void RebornSimulation::resolveContact(Projectile &p, const Contact &c)
+{
+    const Vec2 n = c.normal;
+    const float pen = c.penetration;
+    const int i = c.brick;
+
+    p.markHit();
+
+    // Damage & scoring
+    score += 5;
+    if (bricks.damage(i, 1))
+    {
+        score += bricks.maxHP[i] * 10;
+        if (mode == Mode::Endless)
+            budget += ENDLESS_AMMO_PER_BRICK;
+    }
+    else
+        bricks.color[i] = RebornGame::Brick::colorForHP(bricks.hp[i], bricks.maxHP[i]);
+
+    // Combo: reward accurate shots
+    combo = std::min(combo + 1, 20);
+    score += combo; // small ramp
+
+    // Special shot behavior
+    if (p.getShotType() == Projectile::ShotType::Explosive)
+    {
+        const float R = p.getExplosionRadius();
+        const Vec2 hitPos = p.getPosition();
+
+        const AABB blast{hitPos.x - R, hitPos.y - R, hitPos.x + R, hitPos.y + R};
+        brickGrid.query(blast, blastCandidates);
+        for (const int j : blastCandidates)
+        {
+            if (!bricks.alive[j])
+                continue;
+            const float bcx = bricks.x[j] + bricks.w[j] / 2.0f;
+            const float bcy = bricks.y[j] + bricks.h[j] / 2.0f;
+            const float dx = bcx - hitPos.x;
+            const float dy = bcy - hitPos.y;
+            if (dx * dx + dy * dy <= R * R)
+            {
+                if (bricks.damage(j, 1))
+                {
+                    score += bricks.maxHP[j] * 8;
+                    if (mode == Mode::Endless)
+                        budget += ENDLESS_AMMO_PER_BRICK;
+                }
+                else
+                    bricks.color[j] = RebornGame::Brick::colorForHP(bricks.hp[j], bricks.maxHP[j]);
+            }
+        }
+
+        // Explosive projectile disappears on hit
+        p.kill();
+        return;
+    }
+
+    if (p.getShotType() == Projectile::ShotType::Piercing && p.getPierceRemaining() > 0)
+    {
+        // Keep going through the brick, consume one piercing hit
+        p.setPiercedBrick(i);
+        p.consumePierceHit();
+        return;
+    }
+
+    // Normal bounce (push out of the face, or out of the overlap)
+    p.setVelocity(Collision::reflect(p.getVelocity(), n));
+    const Vec2 pos = p.getPosition();
+    const float push = (pen > 0.0f) ? pen + 0.5f : CONTACT_SKIN;
+    p.setPosition(pos.x + n.x * push, pos.y + n.y * push);
+}
+
+void RebornSimulation::moveProjectiles(float dt, float newShotTime)
+{
+    TRACE_SCOPE("RebornSimulation::moveProjectiles");
+
+    const std::vector<int> &live = projectiles.liveSlots();
+    const int count = static_cast<int>(live.size());
+    projectileTime.assign(count, 0.0f);
+
+    // Fired this step (last in firing order): starts moving partway through the step
+    if (newShotTime > 0.0f && count > 0)
+        projectileTime[count - 1] = newShotTime;
+    projectileContacts.assign(count, 0);
+    contactQueue.clear();
+
+    const auto later = [](const Contact &a, const Contact &b)
+    { return laterContact(a.t, a.projectile, a.brick, b.t, b.projectile, b.brick); };
+
+    Contact c{};
+    for (int i = 0; i < count; i++)
+    {
+        if (!projectiles[live[i]].isDead() && findContact(i, dt, c))
+            contactQueue.push_back(c);
+    }
+    std::make_heap(contactQueue.begin(), contactQueue.end(), later);
+
+    // Earliest contact first, across all projectiles
+    while (!contactQueue.empty())
+    {
+        std::pop_heap(contactQueue.begin(), contactQueue.end(), later);
+        c = contactQueue.back();
+        contactQueue.pop_back();
+
+        Projectile &p = projectiles[live[c.projectile]];
+        if (p.isDead())
+            continue;
+
+        // Brick destroyed by an earlier contact: look for this projectile's next contact
+        if (!bricks.alive[c.brick])
+        {
+            if (findContact(c.projectile, dt, c))
+            {
+                contactQueue.push_back(c);
+                std::push_heap(contactQueue.begin(), contactQueue.end(), later);
+            }
+            continue;
+        }
+
+        // Advance to the time of impact
+        float &t = projectileTime[c.projectile];
+        p.setPosition(p.getPosition() + p.getVelocity() * ((c.t - t) * dt));
+        t = c.t;
+
+        resolveContact(p, c);
+
+        if (!p.isDead() && ++projectileContacts[c.projectile] < MAX_CONTACTS_PER_STEP && findContact(c.projectile, dt, c))
+        {
+            contactQueue.push_back(c);
+            std::push_heap(contactQueue.begin(), contactQueue.end(), later);
+        }
+    }
+
+    // Rest of the step (walls are handled by Projectile::update)
+    for (int i = 0; i < count; i++)
+        projectiles[live[i]].update((1.0f - projectileTime[i]) * dt);
+}
+
+std::uint64_t RebornSimulation::stateHash() const
+{
+    StateHash h;
+    h.add(static_cast<int>(state));
+    h.add(static_cast<int>(loseReason));
+    h.add(score);
+    h.add(used);
+    h.add(combo);
+    h.add(fireCooldown);
+    h.add(static_cast<int>(currentShot));
+    h.add(cannon.getDirectionRadians());
+
+    // Firing order, as the simulation iterates them
+    h.add(static_cast<std::uint64_t>(projectiles.size()));
+    for (const Projectile &p : projectiles)
+    {
+        h.add(p.getPosition());
+        h.add(p.getVelocity());
+        h.add(static_cast<int>(p.getShotType()));
+        h.add(p.getPierceRemaining());
+        h.add(p.isDead());
+    }
+
+    if (mode == Mode::Endless)
+    {
+        h.add(budget);
+        h.add(streamedRows);
+        h.add(topRowY);
+    }
+
+    bricks.hashInto(h);
+    return h.value();
+}
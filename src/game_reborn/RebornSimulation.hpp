@@ -0,0 +1,204 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "../core/BrickField.hpp"
+#include "../core/CollisionBatch.hpp"
+#include "../core/Difficulty.hpp"
+#include "../core/SpatialGrid.hpp"
+#include "../core/Vec2.hpp"
+#include "../level/Level.hpp"
+#include "Cannon.hpp"
+#include "Projectile.hpp"
+#include "ProjectilePool.hpp"
+
+/**
+ * @brief Entrées d'un pas de simulation (version Reborn)
+ */
+struct RebornInput
+{
+    Vec2 aim;                // Point visé (coordonnées du terrain)
+    bool fireHeld = false;   // Tir maintenu
+    bool selectShot = false; // true si le joueur change de type de tir à ce pas
+    Projectile::ShotType shot = Projectile::ShotType::Normal;
+
+    // Appui daté à l'intérieur du pas (échantillonnage de la souris) : le tir part à cet
+    // instant, vers le point visé à cet instant. 0 : début du pas, vers aim.
+    float fireAt = 0.0f; // fraction du pas [0, 1]
+    Vec2 fireAim;        // point visé au moment de l'appui (si fireAt > 0)
+};
+
+/**
+ * @brief Règles du mode Reborn, sans fenêtre ni dépendance SFML
+ *
+ * Canon, projectiles, briques à points de vie, budget de munitions, combo,
+ * descente des briques et conditions de victoire/défaite.
+ *
+ * C'est une valeur : une copie est une partie indépendante qui continue à partir du
+ * même état (bifurcation utilisée par bots/RebornAutoplayer).
+ */
+class RebornSimulation
+{
+public:
+    enum class State
+    {
+        Playing,
+        Win,
+        Lose,
+    };
+
+    enum class LoseReason
+    {
+        OutOfAmmo,
+        DangerLine,
+    };
+
+    /**
+     * @brief Standard : gagner en détruisant toutes les briques.
+     *        Endless : de nouvelles lignes arrivent sans fin par le haut ; chaque brique
+     *        détruite rend une munition, la partie dure tant que le joueur tient (ligne
+     *        de danger, munitions). Une partie enregistrée (Replay) ne garde que ses
+     *        20 premières minutes.
+     */
+    enum class Mode
+    {
+        Standard,
+        Endless,
+    };
+
+    static constexpr float FIELD_W = 800.0f;
+    static constexpr float FIELD_H = 600.0f;
+
+    static constexpr int BRICK_ROWS = 6;
+    static constexpr int BRICK_COLS = 10;
+
+    /**
+     * @param level Grille du niveau (vide : grille intégrée BRICK_ROWS x BRICK_COLS).
+     *              Les points de vie sont ajustés à la difficulté ; au-delà de BRICK_ROWS
+     *              lignes, les premières commencent au-dessus de l'écran et arrivent en descendant.
+     * @param mode  Endless : la grille est le début du flux, les lignes suivantes ont sa largeur
+     * @param seed  Graine des lignes générées (Endless) ; même graine, mêmes lignes
+     */
+    explicit RebornSimulation(Difficulty difficulty, const LevelGrid &level = LevelGrid(),
+                              Mode mode = Mode::Standard, std::uint32_t seed = 0);
+
+    /**
+     * @brief Recommence une partie complète (budget + niveau)
+     */
+    void resetAll();
+
+    /**
+     * @brief Avance la simulation d'un pas
+     *
+     * Les positions précédentes sont mémorisées au début du pas pour l'interpolation du rendu.
+     * @param dt Durée du pas (en secondes)
+     * @param input Entrées du joueur pour ce pas
+     */
+    void step(float dt, const RebornInput &input);
+
+    State getState() const { return state; }
+    LoseReason getLoseReason() const { return loseReason; }
+    int getScore() const { return score; }
+    int getBudget() const { return budget; }
+    int getUsed() const { return used; }
+    int getMaxActive() const { return maxActive; }
+    int getCombo() const { return combo; }
+    float getFireCooldown() const { return fireCooldown; }
+    float getDangerLineY() const { return dangerLineY; }
+    Projectile::ShotType getCurrentShot() const { return currentShot; }
+    Difficulty getDifficulty() const { return difficulty; }
+    LevelGrid getLevel() const { return level.grid(); }
+    Mode getMode() const { return mode; }
+    std::uint32_t getSeed() const { return seed; }
+
+    /**
+     * @brief Lignes générées depuis le début de la partie (Endless)
+     */
+    int getStreamedRows() const { return streamedRows; }
+
+    const Cannon &getCannon() const { return cannon; }
+    const ProjectilePool &getProjectiles() const { return projectiles; }
+    const BrickField &getBricks() const { return bricks; }
+
+    /**
+     * @brief Empreinte de l'état de jeu complet (voir StateHash)
+     *
+     * Deux parties rejouées avec les mêmes entrées doivent donner la même empreinte.
+     */
+    std::uint64_t stateHash() const;
+
+    /**
+     * @brief Descente du champ pendant le dernier pas (interpolation du rendu)
+     */
+    float getLastDescend() const { return lastDescend; }
+
+    /**
+     * @brief Bas de la brique vivante la plus basse (0 si aucune)
+     */
+    float lowestBrickBottom() const;
+
+private:
+    Difficulty difficulty;
+    Level level; // copied: the simulation does not depend on the caller's storage
+    Mode mode;
+    std::uint32_t seed;
+
+    Cannon cannon;
+    ProjectilePool projectiles; // fixed capacity (maxActive), no allocation while playing
+    BrickField bricks;
+    float lastDescend = 0.0f;
+    SpatialGrid brickGrid; // broadphase over bricks, translated as the field descends
+    std::vector<int> blastCandidates; // scratch buffer for explosive splash queries
+
+    int score = 0;
+    int budget = 50;
+    int used = 0;
+    int maxActive = 4;
+    float fireCooldown = 0.0f;
+    int combo = 0;
+
+    State state = State::Playing;
+    LoseReason loseReason = LoseReason::OutOfAmmo;
+    Projectile::ShotType currentShot = Projectile::ShotType::Normal;
+
+    float dangerLineY = FIELD_H - 150.0f;
+
+    // Endless stream: rows are generated above the field into a fixed number of brick
+    // slots; a destroyed brick's slot is reused by a later row
+    BrickLayout streamLayout;
+    int streamCols = 0;
+    std::size_t slotCapacity = 0;
+    float topRowY = 0.0f; // top of the highest row, descends with the field
+    int streamedRows = 0;
+    std::vector<int> rowHp;           // scratch: the row being generated
+    std::vector<int> freeSlots;       // scratch: destroyed bricks' slots
+    std::vector<AABB> brickBoxes;     // scratch: broadphase rebuild
+
+    // Continuous collision: projectile-brick contacts inside one step, by time of impact
+    struct Contact
+    {
+        float t;           // fraction of the step [0, 1]
+        int projectile;    // position in projectiles.liveSlots() (firing order)
+        int brick;         // index into bricks
+        Vec2 normal;       // from the brick towards the projectile
+        float penetration; // > 0 only if the projectile already overlapped the brick
+    };
+
+    std::vector<Contact> contactQueue;   // min-heap on t (scratch, reused every step)
+    std::vector<float> projectileTime;   // fraction of the step already simulated, per live projectile
+    std::vector<int> projectileContacts; // contacts resolved this step, per live projectile
+
+    Collision::CircleRectBatch narrowphase; // gathered candidate bricks (scratch)
+    std::vector<int> narrowphaseBricks;     // brick index of each narrowphase entry
+
+    void resetLevel();
+    void buildBuiltinGrid();
+    void buildLevelGrid();
+    void streamRows();
+    void fire(Projectile::ShotType type, float angle);
+
+    void moveProjectiles(float dt, float newShotTime);
+    bool findContact(int projectileIndex, float dt, Contact &out);
+    void resolveContact(Projectile &p, const Contact &c);
+};
@@ -0,0 +1,359 @@
+#include "Level.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr char PACK_MAGIC[4] = {'C', 'B', 'L', 'P'};
+    constexpr std::uint16_t PACK_VERSION = 1;
+    constexpr std::size_t HEADER_SIZE = 16;
+    constexpr std::size_t ENTRY_SIZE = 16; // u32 rows, u32 cols, u64 offset
+    constexpr std::size_t DATA_ALIGN = 16;
+
+    constexpr int MAX_SIDE = 1 << 16; // rows / cols
+    constexpr std::uint64_t MAX_CELLS = 1ull << 22; // rows * cols (4M bricks): checked before allocating
+
+    // Default brick geometry, as in the built-in grids
+    constexpr float BRICK_W = 72.0f;
+    constexpr float BRICK_H = 28.0f;
+    constexpr float SPACING = 6.0f;
+    constexpr float SIDE_MARGIN = 10.0f;
+
+    std::uint32_t readU32(const std::uint8_t *p)
+    {
+        return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+               (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+    }
+
+    std::uint64_t readU64(const std::uint8_t *p)
+    {
+        return static_cast<std::uint64_t>(readU32(p)) | (static_cast<std::uint64_t>(readU32(p + 4)) << 32);
+    }
+
+    void putU16(std::string &out, std::uint16_t v)
+    {
+        out.push_back(static_cast<char>(v & 0xFF));
+        out.push_back(static_cast<char>(v >> 8));
+    }
+
+    void putU32(std::string &out, std::uint32_t v)
+    {
+        for (int i = 0; i < 4; i++)
+            out.push_back(static_cast<char>((v >> (8 * i)) & 0xFF));
+    }
+
+    void putU64(std::string &out, std::uint64_t v)
+    {
+        putU32(out, static_cast<std::uint32_t>(v));
+        putU32(out, static_cast<std::uint32_t>(v >> 32));
+    }
+
+    std::size_t alignUp(std::size_t v)
+    {
+        return (v + DATA_ALIGN - 1) / DATA_ALIGN * DATA_ALIGN;
+    }
+} // namespace
+
+// --- Level ---
+
+Level::Level(const LevelGrid &grid)
+    : rows(grid.empty() ? 0 : grid.rows),
+      cols(grid.empty() ? 0 : grid.cols)
+{
+    if (!grid.empty())
+        hp.assign(grid.hp, grid.hp + static_cast<std::size_t>(rows) * cols);
+}
+
+bool Level::parseText(const std::string &text, Level &out, std::string &error)
+{
+    // Drop comment lines, then read whitespace-separated integers
+    std::string numbers;
+    std::istringstream lines(text);
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        const std::size_t first = line.find_first_not_of(" \t\r");
+        if (first != std::string::npos && line[first] == '#')
+            continue;
+        numbers += line;
+        numbers += '\n';
+    }
+
+    std::istringstream in(numbers);
+    Level level;
+    if (!(in >> level.rows >> level.cols) || level.rows <= 0 || level.cols <= 0 ||
+        level.rows > MAX_SIDE || level.cols > MAX_SIDE ||
+        static_cast<std::uint64_t>(level.rows) * static_cast<std::uint64_t>(level.cols) > MAX_CELLS)
+    {
+        error = "bad header (expected \"rows cols\")";
+        return false;
+    }
+
+    const std::size_t cells = static_cast<std::size_t>(level.rows) * level.cols;
+    level.hp.resize(cells);
+    for (std::size_t i = 0; i < cells; i++)
+    {
+        int v = 0;
+        if (!(in >> v))
+        {
+            error = "expected " + std::to_string(cells) + " hit point values, got " + std::to_string(i);
+            return false;
+        }
+        if (v < 0 || v > 255)
+        {
+            error = "hit points out of range (0..255): " + std::to_string(v);
+            return false;
+        }
+        level.hp[i] = static_cast<std::uint8_t>(v);
+    }
+
+    out = std::move(level);
+    return true;
+}
+
+bool Level::loadText(const std::string &path, Level &out, std::string &error)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        error = "cannot open " + path;
+        return false;
+    }
+    const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (!parseText(text, out, error))
+    {
+        error = path + ": " + error;
+        return false;
+    }
+    return true;
+}
+
+// --- BrickLayout ---
+
+BrickLayout BrickLayout::fit(int rows, int cols, float fieldW, float top, float maxHeight)
+{
+    BrickLayout l;
+
+    // Shrink uniformly (brick size and spacing) until the grid fits
+    const float fullW = cols * BRICK_W + (cols - 1) * SPACING;
+    const float fullH = rows * BRICK_H + (rows - 1) * SPACING;
+    float scale = std::min(1.0f, (fieldW - 2.0f * SIDE_MARGIN) / fullW);
+    if (maxHeight > 0.0f)
+        scale = std::min(scale, maxHeight / fullH);
+
+    l.brickW = BRICK_W * scale;
+    l.brickH = BRICK_H * scale;
+    l.spacing = SPACING * scale;
+    l.startX = (fieldW - fullW * scale) / 2.0f;
+    l.startY = top;
+    return l;
+}
+
+// --- LevelPack ---
+
+LevelPack::~LevelPack()
+{
+    close();
+}
+
+LevelPack::LevelPack(LevelPack &&other) noexcept
+{
+    *this = std::move(other);
+}
+
+LevelPack &LevelPack::operator=(LevelPack &&other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        std::swap(data, other.data);
+        std::swap(bytes, other.bytes);
+        std::swap(levelCount, other.levelCount);
+#if defined(_WIN32)
+        std::swap(fileHandle, other.fileHandle);
+        std::swap(mappingHandle, other.mappingHandle);
+#endif
+    }
+    return *this;
+}
+
+bool LevelPack::open(const std::string &path, std::string &error)
+{
+    close();
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        error = "cannot open " + path;
+        return false;
+    }
+    LARGE_INTEGER size{};
+    GetFileSizeEx(file, &size);
+    HANDLE mapping = (size.QuadPart > 0) ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+    const void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view)
+    {
+        if (mapping)
+            CloseHandle(mapping);
+        CloseHandle(file);
+        error = "cannot map " + path;
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = mapping;
+    data = static_cast<const std::uint8_t *>(view);
+    bytes = static_cast<std::size_t>(size.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        error = "cannot open " + path;
+        return false;
+    }
+    struct stat st{};
+    void *view = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+        view = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // the mapping keeps the file alive
+    if (view == MAP_FAILED)
+    {
+        error = "cannot map " + path;
+        return false;
+    }
+    data = static_cast<const std::uint8_t *>(view);
+    bytes = static_cast<std::size_t>(st.st_size);
+#endif
+
+    // Header and table only: the grids themselves are never touched here
+    if (bytes < HEADER_SIZE || std::memcmp(data, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0)
+    {
+        close();
+        error = path + ": not a level pack";
+        return false;
+    }
+    const std::uint16_t version = static_cast<std::uint16_t>(data[4] | (data[5] << 8));
+    if (version != PACK_VERSION)
+    {
+        close();
+        error = path + ": unsupported level pack version " + std::to_string(version);
+        return false;
+    }
+
+    const std::size_t count = readU32(data + 8);
+    if (count > (bytes - HEADER_SIZE) / ENTRY_SIZE)
+    {
+        close();
+        error = path + ": truncated level table";
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++)
+    {
+        const std::uint8_t *e = data + HEADER_SIZE + i * ENTRY_SIZE;
+        const std::uint64_t rows = readU32(e);
+        const std::uint64_t cols = readU32(e + 4);
+        const std::uint64_t offset = readU64(e + 8);
+        if (rows == 0 || cols == 0 || rows > MAX_SIDE || cols > MAX_SIDE || rows * cols > MAX_CELLS ||
+            offset > bytes || rows * cols > bytes - offset)
+        {
+            close();
+            error = path + ": corrupt entry for level " + std::to_string(i);
+            return false;
+        }
+    }
+
+    levelCount = count;
+    return true;
+}
+
+void LevelPack::close()
+{
+    if (!data)
+        return;
+
+#if defined(_WIN32)
+    UnmapViewOfFile(data);
+    CloseHandle(static_cast<HANDLE>(mappingHandle));
+    CloseHandle(static_cast<HANDLE>(fileHandle));
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    munmap(const_cast<std::uint8_t *>(data), bytes);
+#endif
+    data = nullptr;
+    bytes = 0;
+    levelCount = 0;
+}
+
+LevelGrid LevelPack::level(std::size_t i) const
+{
+    if (i >= levelCount)
+        return LevelGrid();
+
+    const std::uint8_t *e = data + HEADER_SIZE + i * ENTRY_SIZE;
+    LevelGrid g;
+    g.rows = static_cast<int>(readU32(e));
+    g.cols = static_cast<int>(readU32(e + 4));
+    g.hp = data + readU64(e + 8);
+    return g;
+}
+
+bool LevelPack::write(const std::string &path, const std::vector<LevelGrid> &levels, std::string &error)
+{
+    std::string out;
+    out.append(PACK_MAGIC, sizeof(PACK_MAGIC));
+    putU16(out, PACK_VERSION);
+    putU16(out, 0); // reserved
+    putU32(out, static_cast<std::uint32_t>(levels.size()));
+    putU32(out, 0); // reserved
+
+    std::size_t offset = alignUp(HEADER_SIZE + levels.size() * ENTRY_SIZE);
+    for (const LevelGrid &g : levels)
+    {
+        if (g.empty())
+        {
+            error = "empty level";
+            return false;
+        }
+        putU32(out, static_cast<std::uint32_t>(g.rows));
+        putU32(out, static_cast<std::uint32_t>(g.cols));
+        putU64(out, offset);
+        offset = alignUp(offset + static_cast<std::size_t>(g.rows) * g.cols);
+    }
+
+    for (const LevelGrid &g : levels)
+    {
+        out.resize(alignUp(out.size()), '\0');
+        out.append(reinterpret_cast<const char *>(g.hp), static_cast<std::size_t>(g.rows) * g.cols);
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        error = "cannot write " + path;
+        return false;
+    }
+    file.write(out.data(), static_cast<std::streamsize>(out.size()));
+    if (!file)
+    {
+        error = "cannot write " + path;
+        return false;
+    }
+    return true;
+}
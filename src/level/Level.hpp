@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Vue sur une grille de niveau : rows x cols points de vie, ligne par ligne (0 = vide)
+ *
+ * Ne possède pas les données : elles vivent dans un Level ou dans un LevelPack projeté
+ * en mémoire. Une vue vide (rows == 0) désigne la grille intégrée de chaque mode.
+ */
+struct LevelGrid
+{
+    int rows = 0;
+    int cols = 0;
+    const std::uint8_t *hp = nullptr;
+
+    bool empty() const { return rows <= 0 || cols <= 0; }
+    int at(int r, int c) const { return hp[static_cast<std::size_t>(r) * cols + c]; }
+};
+
+/**
+ * @brief Grille de niveau possédée (copie d'une vue, ou lue depuis un fichier texte)
+ *
+ * Format texte (levels/level1.txt) : « rows cols » puis rows lignes de cols points de vie
+ * séparés par des espaces ; les lignes commençant par # sont ignorées.
+ */
+struct Level
+{
+    int rows = 0;
+    int cols = 0;
+    std::vector<std::uint8_t> hp;
+
+    Level() = default;
+    explicit Level(const LevelGrid &grid);
+
+    LevelGrid grid() const { return LevelGrid{rows, cols, hp.data()}; }
+    bool empty() const { return grid().empty(); }
+
+    static bool parseText(const std::string &text, Level &out, std::string &error);
+    static bool loadText(const std::string &path, Level &out, std::string &error);
+};
+
+/**
+ * @brief Placement des briques d'une grille dans le terrain
+ *
+ * Géométrie des modes (72 x 28, espacement 6, centré), réduite si la grille ne tient
+ * pas dans la largeur (ou la hauteur maximale donnée).
+ */
+struct BrickLayout
+{
+    float startX = 0.0f;
+    float startY = 0.0f;
+    float brickW = 72.0f;
+    float brickH = 28.0f;
+    float spacing = 6.0f;
+
+    float x(int col) const { return startX + col * (brickW + spacing); }
+    float y(int row) const { return startY + row * (brickH + spacing); }
+
+    /**
+     * @param maxHeight Hauteur disponible à partir de top (<= 0 : pas de limite)
+     */
+    static BrickLayout fit(int rows, int cols, float fieldW, float top, float maxHeight);
+};
+
+/**
+ * @brief Paquet de niveaux compilé (.cblp), projeté en mémoire (mmap)
+ *
+ * Fichier little-endian : en-tête de 16 octets (« CBLP », version, nombre de niveaux),
+ * table de niveaux (rows, cols, décalage), puis les points de vie bruts de chaque
+ * niveau, alignés sur 16 octets. level(i) renvoie une vue directement dans la
+ * projection : ouvrir un paquet ne lit ni n'analyse les grilles, quelle que soit leur taille.
+ */
+class LevelPack
+{
+public:
+    LevelPack() = default;
+    ~LevelPack();
+
+    LevelPack(const LevelPack &) = delete;
+    LevelPack &operator=(const LevelPack &) = delete;
+    LevelPack(LevelPack &&other) noexcept;
+    LevelPack &operator=(LevelPack &&other) noexcept;
+
+    /**
+     * @brief Projette le fichier et vérifie l'en-tête et la table
+     */
+    bool open(const std::string &path, std::string &error);
+    void close();
+
+    bool isOpen() const { return data != nullptr; }
+    std::size_t size() const { return levelCount; }
+    LevelGrid level(std::size_t i) const;
+
+    /**
+     * @brief Compile des grilles en paquet
+     */
+    static bool write(const std::string &path, const std::vector<LevelGrid> &levels, std::string &error);
+
+private:
+    const std::uint8_t *data = nullptr;
+    std::size_t bytes = 0;
+    std::size_t levelCount = 0;
+
+#if defined(_WIN32)
+    void *fileHandle = nullptr;
+    void *mappingHandle = nullptr;
+#endif
+};
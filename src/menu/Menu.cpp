@@ -70,7 +70,6 @@ Menu::Menu()
     : window(sf::VideoMode(800, 600), "Casse-Briques - Menu Principal"),
       selectedOption(0), optionSelected(false)
 {
-    window.setFramerateLimit(60);
     init();
 }
 
@@ -146,6 +145,7 @@ int Menu::show()
 {
     while (window.isOpen() && !optionSelected)
     {
+        pacer.wait();
         handleEvents();
         update();
         draw();
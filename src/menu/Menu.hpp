@@ -4,6 +4,8 @@
 #include <vector>
 #include <functional>
 
+#include "../core/FramePacer.hpp"
+
 /**
  * @brief Classe pour créer un bouton cliquable
  */
@@ -36,6 +38,7 @@ class Menu
 {
 private:
     sf::RenderWindow window;
+    FramePacer pacer; // 60 fps
     sf::Font font;
     sf::Text titleText;
     std::vector<Button> buttons;
@@ -0,0 +1,112 @@
+#include "BrickLayer.hpp"
+
+#include "../core/Trace.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Render
+{
+
+    void BrickLayer::draw(sf::RenderTarget &target, const BrickField &bricks, float offsetY)
+    {
+        if (textureOk)
+        {
+            if (!valid || bricks.getLayoutVersion() != layoutVersion)
+                rebuild(bricks);
+            else if (logPosition < bricks.getChangeLog().size())
+                applyChanges(bricks);
+        }
+
+        if (!textureOk)
+        {
+            // No render-to-texture support: draw the field directly
+            batch.clear();
+            batch.addBrickField(bricks, offsetY);
+            batch.flush(target);
+            return;
+        }
+        if (bricks.size() == 0)
+            return;
+
+        // The cached layer is in untranslated field coordinates: descent is a transform
+        sf::Sprite sprite(texture.getTexture(), sf::IntRect(0, 0, textureSize.x, textureSize.y));
+        sprite.setPosition(originX, originY + bricks.getTranslationY() + offsetY);
+        target.draw(sprite);
+    }
+
+    void BrickLayer::rebuild(const BrickField &bricks)
+    {
+        TRACE_SCOPE("BrickLayer::rebuild");
+
+        valid = true;
+        layoutVersion = bricks.getLayoutVersion();
+        logPosition = bricks.getChangeLog().size();
+
+        if (bricks.size() == 0)
+            return;
+
+        // Bounds of every brick (destroyed ones included: their slot may be redrawn later)
+        const float ty = bricks.getTranslationY();
+        float minX = bricks.x[0];
+        float minY = bricks.y[0] - ty;
+        float maxX = minX;
+        float maxY = minY;
+        for (std::size_t i = 0; i < bricks.size(); i++)
+        {
+            minX = std::min(minX, bricks.x[i]);
+            minY = std::min(minY, bricks.y[i] - ty);
+            maxX = std::max(maxX, bricks.x[i] + bricks.w[i]);
+            maxY = std::max(maxY, bricks.y[i] - ty + bricks.h[i]);
+        }
+        originX = std::floor(minX);
+        originY = std::floor(minY);
+
+        const unsigned needW = static_cast<unsigned>(std::ceil(maxX - originX));
+        const unsigned needH = static_cast<unsigned>(std::ceil(maxY - originY));
+
+        // Only grow the texture; a smaller layout uses the top-left part of it
+        const sf::Vector2u current = texture.getSize();
+        if (needW > current.x || needH > current.y)
+        {
+            if (!texture.create(std::max(needW, current.x), std::max(needH, current.y)))
+            {
+                textureOk = false;
+                return;
+            }
+        }
+        textureSize = sf::Vector2u(needW, needH);
+
+        texture.clear(sf::Color::Transparent);
+        batch.clear();
+        for (std::size_t i = 0; i < bricks.size(); i++)
+        {
+            if (bricks.alive[i])
+                addBrick(bricks, i);
+        }
+        batch.flush(texture);
+        texture.display();
+    }
+
+    void BrickLayer::applyChanges(const BrickField &bricks)
+    {
+        TRACE_SCOPE("BrickLayer::applyChanges");
+
+        const std::vector<int> &log = bricks.getChangeLog();
+
+        // Overwrite each changed slot (no blending): its new color, or transparent if destroyed
+        batch.clear();
+        for (; logPosition < log.size(); logPosition++)
+            addBrick(bricks, static_cast<std::size_t>(log[logPosition]));
+        batch.flush(texture, sf::RenderStates(sf::BlendNone));
+        texture.display();
+    }
+
+    void BrickLayer::addBrick(const BrickField &bricks, std::size_t i)
+    {
+        const sf::Color color = bricks.alive[i] ? toSf(bricks.color[i]) : sf::Color::Transparent;
+        batch.addRect(bricks.x[i] - originX, bricks.y[i] - bricks.getTranslationY() - originY,
+                      bricks.w[i], bricks.h[i], color);
+    }
+
+} // namespace Render
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include <cstdint>
+
+#include "../core/BrickField.hpp"
+#include "ObjectRenderer.hpp"
+
+namespace Render
+{
+    /**
+     * @brief Couche de briques mise en cache dans une sf::RenderTexture
+     *
+     * Le champ est dessiné une fois dans la texture, puis seules les briques du journal
+     * des changements (touchées ou détruites) y sont redessinées. Une descente du champ
+     * (BrickField::translateY) ne redessine rien : elle devient une translation du sprite.
+     * Un changement de disposition (nouveau niveau) reconstruit toute la couche.
+     *
+     * Si la RenderTexture ne peut pas être créée, les briques sont dessinées directement.
+     */
+    class BrickLayer
+    {
+    public:
+        /**
+         * @brief Met la couche à jour puis la dessine
+         * @param offsetY Décalage vertical supplémentaire (interpolation de la descente)
+         */
+        void draw(sf::RenderTarget &target, const BrickField &bricks, float offsetY = 0.0f);
+
+        /**
+         * @brief Force une reconstruction complète au prochain draw()
+         */
+        void invalidate() { valid = false; }
+
+    private:
+        sf::RenderTexture texture;
+        sf::Vector2u textureSize;
+        bool textureOk = true;
+
+        ShapeBatch batch; // briques à écrire dans la texture (ou fallback direct)
+
+        bool valid = false;
+        std::uint32_t layoutVersion = 0;
+        std::size_t logPosition = 0; // entrées du journal déjà appliquées
+
+        // Coin haut-gauche de la texture, en coordonnées du champ non translaté
+        float originX = 0.0f;
+        float originY = 0.0f;
+
+        void rebuild(const BrickField &bricks);
+        void applyChanges(const BrickField &bricks);
+        void addBrick(const BrickField &bricks, std::size_t i);
+    };
+} // namespace Render
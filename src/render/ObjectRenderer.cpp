@@ -0,0 +1,165 @@
+#include "ObjectRenderer.hpp"
+
+#include "../game_reborn/Cannon.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace Render
+{
+
+    namespace
+    {
+        // Unit circle, shared by every circle of every batch
+        const std::array<sf::Vector2f, ShapeBatch::CIRCLE_POINTS> &unitCircle()
+        {
+            static const std::array<sf::Vector2f, ShapeBatch::CIRCLE_POINTS> points = []
+            {
+                std::array<sf::Vector2f, ShapeBatch::CIRCLE_POINTS> pts;
+                const float step = 2.0f * 3.14159265358979323846f / ShapeBatch::CIRCLE_POINTS;
+                for (int k = 0; k < ShapeBatch::CIRCLE_POINTS; k++)
+                    pts[k] = sf::Vector2f(std::cos(k * step), std::sin(k * step));
+                return pts;
+            }();
+            return points;
+        }
+
+        void writeQuad(sf::Vertex *v, const sf::Vector2f &a, const sf::Vector2f &b,
+                       const sf::Vector2f &c, const sf::Vector2f &d, const sf::Color &color)
+        {
+            // Two triangles: a-b-c, a-c-d
+            v[0] = sf::Vertex(a, color);
+            v[1] = sf::Vertex(b, color);
+            v[2] = sf::Vertex(c, color);
+            v[3] = sf::Vertex(a, color);
+            v[4] = sf::Vertex(c, color);
+            v[5] = sf::Vertex(d, color);
+        }
+    } // namespace
+
+    ShapeBatch::ShapeBatch() : vertices(sf::Triangles)
+    {
+    }
+
+    void ShapeBatch::clear()
+    {
+        used = 0;
+    }
+
+    sf::Vertex *ShapeBatch::reserve(std::size_t count)
+    {
+        // Grow only; after the first frames no frame reallocates
+        if (used + count > vertices.getVertexCount())
+            vertices.resize(std::max(used + count, vertices.getVertexCount() * 2));
+
+        sf::Vertex *v = &vertices[used];
+        used += count;
+        return v;
+    }
+
+    void ShapeBatch::addRect(float x, float y, float w, float h, const sf::Color &color)
+    {
+        writeQuad(reserve(6), sf::Vector2f(x, y), sf::Vector2f(x + w, y),
+                  sf::Vector2f(x + w, y + h), sf::Vector2f(x, y + h), color);
+    }
+
+    void ShapeBatch::addRect(const sf::Transform &transform, float w, float h, const sf::Color &color)
+    {
+        writeQuad(reserve(6),
+                  transform.transformPoint(sf::Vector2f(0.0f, 0.0f)),
+                  transform.transformPoint(sf::Vector2f(w, 0.0f)),
+                  transform.transformPoint(sf::Vector2f(w, h)),
+                  transform.transformPoint(sf::Vector2f(0.0f, h)), color);
+    }
+
+    void ShapeBatch::addCircle(const Vec2 &center, float radius, const sf::Color &color)
+    {
+        const auto &unit = unitCircle();
+        const sf::Vector2f c = toSf(center);
+
+        // Triangle fan around the center, flattened into triangles
+        sf::Vertex *v = reserve(3 * CIRCLE_POINTS);
+        for (int k = 0; k < CIRCLE_POINTS; k++)
+        {
+            const sf::Vector2f &p0 = unit[k];
+            const sf::Vector2f &p1 = unit[(k + 1) % CIRCLE_POINTS];
+            v[3 * k + 0] = sf::Vertex(c, color);
+            v[3 * k + 1] = sf::Vertex(sf::Vector2f(c.x + p0.x * radius, c.y + p0.y * radius), color);
+            v[3 * k + 2] = sf::Vertex(sf::Vector2f(c.x + p1.x * radius, c.y + p1.y * radius), color);
+        }
+    }
+
+    ObjectSnapshot ObjectSnapshot::of(const GameObject &obj)
+    {
+        ObjectSnapshot o;
+        o.previous = obj.getPreviousPosition();
+        o.position = obj.getPosition();
+        o.size = obj.getSize();
+        o.radius = obj.getRadius();
+        o.rotation = obj.getRotation();
+        o.isCircle = obj.getIsCircle();
+        o.color = obj.getColor();
+        return o;
+    }
+
+    void ShapeBatch::addObject(const GameObject &obj, float alpha)
+    {
+        addObject(ObjectSnapshot::of(obj), alpha);
+    }
+
+    void ShapeBatch::addObject(const ObjectSnapshot &obj, float alpha)
+    {
+        const Vec2 pos = obj.interpolated(alpha);
+        const sf::Color color = toSf(obj.color);
+
+        if (obj.isCircle)
+        {
+            // Rotation does not change a filled circle
+            addCircle(pos, obj.radius, color);
+            return;
+        }
+
+        if (obj.rotation == 0.0f)
+        {
+            addRect(pos.x, pos.y, obj.size.x, obj.size.y, color);
+            return;
+        }
+
+        // Same as sf::RectangleShape: rotation around the top-left corner
+        sf::Transform t;
+        t.translate(pos.x, pos.y).rotate(obj.rotation);
+        addRect(t, obj.size.x, obj.size.y, color);
+    }
+
+    void ShapeBatch::addBrickField(const BrickField &bricks, float offsetY)
+    {
+        for (std::size_t i = 0; i < bricks.size(); i++)
+        {
+            if (!bricks.alive[i])
+                continue;
+            addRect(bricks.x[i], bricks.y[i] + offsetY, bricks.w[i], bricks.h[i], toSf(bricks.color[i]));
+        }
+    }
+
+    void ShapeBatch::addCannon(const Cannon &cannon)
+    {
+        addCannon(ObjectSnapshot::of(cannon));
+    }
+
+    void ShapeBatch::addCannon(const ObjectSnapshot &cannon)
+    {
+        // Origine au centre du bas pour que la rotation soit autour de la base
+        sf::Transform t;
+        t.translate(cannon.position.x, cannon.position.y).rotate(cannon.rotation).translate(-cannon.size.x / 2.0f, -cannon.size.y);
+        addRect(t, cannon.size.x, cannon.size.y, toSf(cannon.color));
+    }
+
+    void ShapeBatch::flush(sf::RenderTarget &target, const sf::RenderStates &states) const
+    {
+        if (used == 0)
+            return;
+        target.draw(&vertices[0], used, sf::Triangles, states);
+    }
+
+} // namespace Render
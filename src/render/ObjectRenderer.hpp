@@ -0,0 +1,103 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include "../core/BrickField.hpp"
+#include "../core/Color.hpp"
+#include "../core/GameObject.hpp"
+#include "../core/Vec2.hpp"
+
+class Cannon;
+
+/**
+ * @brief Dessin SFML des objets de simulation (qui, eux, ne dépendent pas de SFML)
+ */
+namespace Render
+{
+    inline sf::Vector2f toSf(const Vec2 &v) { return sf::Vector2f(v.x, v.y); }
+    inline Vec2 fromSf(const sf::Vector2f &v) { return Vec2(v.x, v.y); }
+    inline sf::Color toSf(const Color &c) { return sf::Color(c.r, c.g, c.b, c.a); }
+
+    /**
+     * @brief Ce que le rendu lit d'un GameObject, copié dans une image de scène (SceneFrame)
+     *
+     * Sans vtable ni état de simulation : un tableau de ces instantanés se recopie d'un
+     * pas à l'autre sans allocation.
+     */
+    struct ObjectSnapshot
+    {
+        Vec2 previous; // position au pas précédent (interpolation)
+        Vec2 position;
+        Vec2 size;
+        float radius = 0.0f;
+        float rotation = 0.0f;
+        bool isCircle = false;
+        Color color;
+
+        static ObjectSnapshot of(const GameObject &obj);
+
+        Vec2 interpolated(float alpha) const { return previous + (position - previous) * alpha; }
+    };
+
+    /**
+     * @brief Lot de formes pleines dessiné en un seul appel (un sf::VertexArray de triangles)
+     *
+     * Chaque frame : clear(), puis add...() pour chaque objet, puis flush().
+     * Les rectangles et les cercles (géométrie du cercle unité précalculée, partagée)
+     * sont écrits dans le même tableau de sommets ; la mémoire est conservée d'une
+     * frame à l'autre. Les formes sont dessinées dans l'ordre d'ajout.
+     */
+    class ShapeBatch
+    {
+    public:
+        static constexpr int CIRCLE_POINTS = 30; // comme sf::CircleShape par défaut
+
+        ShapeBatch();
+
+        void clear();
+
+        /**
+         * @brief Rectangle aligné sur les axes (coin haut-gauche + taille)
+         */
+        void addRect(float x, float y, float w, float h, const sf::Color &color);
+
+        /**
+         * @brief Rectangle w x h placé par une transformation (rotation, origine...)
+         */
+        void addRect(const sf::Transform &transform, float w, float h, const sf::Color &color);
+
+        void addCircle(const Vec2 &center, float radius, const sf::Color &color);
+
+        /**
+         * @brief Ajoute un GameObject (cercle ou rectangle selon sa forme)
+         * @param alpha Interpolation entre la position précédente et courante (1 = position courante)
+         */
+        void addObject(const GameObject &obj, float alpha = 1.0f);
+        void addObject(const ObjectSnapshot &obj, float alpha = 1.0f);
+
+        /**
+         * @brief Ajoute les briques vivantes d'un BrickField
+         * @param offsetY Décalage vertical appliqué à tout le champ (interpolation de la descente)
+         */
+        void addBrickField(const BrickField &bricks, float offsetY = 0.0f);
+
+        /**
+         * @brief Ajoute le canon, tourné autour du centre de sa base
+         */
+        void addCannon(const Cannon &cannon);
+        void addCannon(const ObjectSnapshot &cannon);
+
+        /**
+         * @brief Dessine tout le lot (un seul draw call)
+         */
+        void flush(sf::RenderTarget &target, const sf::RenderStates &states = sf::RenderStates::Default) const;
+
+        std::size_t getVertexCount() const { return used; }
+
+    private:
+        sf::VertexArray vertices;
+        std::size_t used = 0; // sommets écrits cette frame (le tableau ne rétrécit pas)
+
+        sf::Vertex *reserve(std::size_t count);
+    };
+} // namespace Render
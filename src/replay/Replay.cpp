@@ -0,0 +1,396 @@
+#include "Replay.hpp"
+
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+    constexpr char MAGIC[4] = {'C', 'B', 'R', 'P'};
+    constexpr std::uint16_t FORMAT_VERSION = 5; // 2: result trailer, 3: level grid, 4: endless flag, 5: u16 flags, timed fire
+
+    // Tick flags (u8 in the file before version 5, u16 since)
+    constexpr std::uint16_t MOVE_LEFT = 1u << 0;
+    constexpr std::uint16_t MOVE_RIGHT = 1u << 1;
+    constexpr std::uint16_t LAUNCH = 1u << 2;
+    constexpr std::uint16_t FIRE_HELD = 1u << 3;
+    constexpr std::uint16_t SELECT_SHOT = 1u << 4;
+    constexpr std::uint16_t SHOT_SHIFT = 5; // 2 bits: Projectile::ShotType
+    constexpr std::uint16_t SHOT_MASK = 3u << SHOT_SHIFT;
+    constexpr std::uint16_t AIM_CHANGED = 1u << 7; // file only: aim follows the flags
+    constexpr std::uint16_t FIRE_TIMED = 1u << 8;  // Reborn: fire time + aim follow
+
+    // Flags each mode may use; any other bit makes the file corrupt
+    constexpr std::uint16_t CLASSIC_FLAGS = MOVE_LEFT | MOVE_RIGHT | LAUNCH;
+    constexpr std::uint16_t REBORN_FLAGS = FIRE_HELD | SELECT_SHOT | SHOT_MASK | FIRE_TIMED;
+
+    // --- little-endian encoding ---
+
+    void putU8(std::string &out, std::uint8_t v)
+    {
+        out.push_back(static_cast<char>(v));
+    }
+
+    void putU16(std::string &out, std::uint16_t v)
+    {
+        putU8(out, static_cast<std::uint8_t>(v));
+        putU8(out, static_cast<std::uint8_t>(v >> 8));
+    }
+
+    void putU32(std::string &out, std::uint32_t v)
+    {
+        for (int i = 0; i < 4; i++)
+            putU8(out, static_cast<std::uint8_t>(v >> (8 * i)));
+    }
+
+    // Raw bits: the replayed aim is bit-identical to the recorded one
+    void putF32(std::string &out, float f)
+    {
+        std::uint32_t bits = 0;
+        std::memcpy(&bits, &f, sizeof(bits));
+        putU32(out, bits);
+    }
+
+    void putU64(std::string &out, std::uint64_t v)
+    {
+        putU32(out, static_cast<std::uint32_t>(v));
+        putU32(out, static_cast<std::uint32_t>(v >> 32));
+    }
+
+    void putVarint(std::string &out, std::uint32_t v)
+    {
+        while (v >= 0x80)
+        {
+            putU8(out, static_cast<std::uint8_t>(v | 0x80));
+            v >>= 7;
+        }
+        putU8(out, static_cast<std::uint8_t>(v));
+    }
+
+    struct Reader
+    {
+        const std::string &data;
+        std::size_t pos = 0;
+        bool ok = true;
+
+        std::uint8_t u8()
+        {
+            if (pos >= data.size())
+            {
+                ok = false;
+                return 0;
+            }
+            return static_cast<std::uint8_t>(data[pos++]);
+        }
+
+        std::uint16_t u16()
+        {
+            const std::uint16_t lo = u8();
+            return static_cast<std::uint16_t>(lo | (u8() << 8));
+        }
+
+        std::uint32_t u32()
+        {
+            std::uint32_t v = 0;
+            for (int i = 0; i < 4; i++)
+                v |= static_cast<std::uint32_t>(u8()) << (8 * i);
+            return v;
+        }
+
+        std::uint64_t u64()
+        {
+            const std::uint64_t lo = u32();
+            return lo | (static_cast<std::uint64_t>(u32()) << 32);
+        }
+
+        float f32()
+        {
+            const std::uint32_t bits = u32();
+            float f = 0.0f;
+            std::memcpy(&f, &bits, sizeof(f));
+            return f;
+        }
+
+        std::uint32_t varint()
+        {
+            std::uint32_t v = 0;
+            for (int shift = 0; shift < 35; shift += 7)
+            {
+                const std::uint8_t b = u8();
+                v |= static_cast<std::uint32_t>(b & 0x7F) << shift;
+                if (!(b & 0x80))
+                    return v;
+            }
+            ok = false;
+            return 0;
+        }
+    };
+
+    bool sameBits(float a, float b)
+    {
+        return std::memcmp(&a, &b, sizeof(float)) == 0;
+    }
+} // namespace
+
+void Replay::record(const ClassicInput &input)
+{
+    Tick t;
+    t.flags = static_cast<std::uint16_t>((input.moveLeft ? MOVE_LEFT : 0) |
+                                        (input.moveRight ? MOVE_RIGHT : 0) |
+                                        (input.launch ? LAUNCH : 0));
+    ticks.push_back(t);
+}
+
+void Replay::record(const RebornInput &input)
+{
+    Tick t;
+    t.flags = static_cast<std::uint16_t>((input.fireHeld ? FIRE_HELD : 0) |
+                                        (input.selectShot ? SELECT_SHOT : 0) |
+                                        ((static_cast<std::uint8_t>(input.shot) << SHOT_SHIFT) & SHOT_MASK) |
+                                        (input.fireAt > 0.0f ? FIRE_TIMED : 0));
+    t.aimX = input.aim.x;
+    t.aimY = input.aim.y;
+    if (input.fireAt > 0.0f)
+    {
+        t.fireAt = input.fireAt;
+        t.fireAimX = input.fireAim.x;
+        t.fireAimY = input.fireAim.y;
+    }
+    ticks.push_back(t);
+}
+
+ClassicInput Replay::classicInput(std::size_t tick) const
+{
+    ClassicInput in;
+    if (tick >= ticks.size())
+        return in;
+
+    const std::uint16_t f = ticks[tick].flags;
+    in.moveLeft = (f & MOVE_LEFT) != 0;
+    in.moveRight = (f & MOVE_RIGHT) != 0;
+    in.launch = (f & LAUNCH) != 0;
+    return in;
+}
+
+RebornInput Replay::rebornInput(std::size_t tick) const
+{
+    RebornInput in;
+    if (tick >= ticks.size())
+        return in;
+
+    const Tick &t = ticks[tick];
+    in.aim = Vec2(t.aimX, t.aimY);
+    in.fireHeld = (t.flags & FIRE_HELD) != 0;
+    in.selectShot = (t.flags & SELECT_SHOT) != 0;
+    in.shot = static_cast<Projectile::ShotType>((t.flags & SHOT_MASK) >> SHOT_SHIFT);
+    if (t.flags & FIRE_TIMED)
+    {
+        in.fireAt = t.fireAt;
+        in.fireAim = Vec2(t.fireAimX, t.fireAimY);
+    }
+    return in;
+}
+
+bool Replay::saveToFile(const std::string &path) const
+{
+    std::string out;
+    out.append(MAGIC, sizeof(MAGIC));
+    putU16(out, FORMAT_VERSION);
+    putU8(out, static_cast<std::uint8_t>(header.mode));
+    putU8(out, static_cast<std::uint8_t>(header.difficulty));
+    putU16(out, static_cast<std::uint16_t>(header.simulationHz));
+    putU32(out, header.seed);
+    putU32(out, static_cast<std::uint32_t>(ticks.size()));
+
+    // Level grid (0 x 0: the mode's built-in grid)
+    putU32(out, static_cast<std::uint32_t>(header.level.rows));
+    putU32(out, static_cast<std::uint32_t>(header.level.cols));
+    out.append(reinterpret_cast<const char *>(header.level.hp.data()), header.level.hp.size());
+    putU8(out, header.endless ? 1 : 0);
+
+    // Runs of identical ticks; the aim is only written when it changes. A timed press is
+    // a tick of its own, followed by its time and aim
+    float aimX = 0.0f;
+    float aimY = 0.0f;
+    std::size_t i = 0;
+    while (i < ticks.size())
+    {
+        const Tick &t = ticks[i];
+        const bool timed = (t.flags & FIRE_TIMED) != 0;
+        std::size_t run = 1;
+        while (!timed && i + run < ticks.size() && ticks[i + run].flags == t.flags &&
+               sameBits(ticks[i + run].aimX, t.aimX) && sameBits(ticks[i + run].aimY, t.aimY))
+            run++;
+
+        const bool aimChanged = !sameBits(t.aimX, aimX) || !sameBits(t.aimY, aimY);
+        putU16(out, static_cast<std::uint16_t>(t.flags | (aimChanged ? AIM_CHANGED : 0)));
+        if (aimChanged)
+        {
+            putF32(out, t.aimX);
+            putF32(out, t.aimY);
+            aimX = t.aimX;
+            aimY = t.aimY;
+        }
+        if (timed)
+        {
+            putF32(out, t.fireAt);
+            putF32(out, t.fireAimX);
+            putF32(out, t.fireAimY);
+        }
+        putVarint(out, static_cast<std::uint32_t>(run - 1));
+        i += run;
+    }
+
+    putU8(out, result.known ? 1 : 0);
+    putU32(out, static_cast<std::uint32_t>(result.score));
+    putU64(out, result.stateHash);
+
+    const std::filesystem::path p(path);
+    std::error_code ec;
+    if (p.has_parent_path())
+        std::filesystem::create_directories(p.parent_path(), ec);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+        return false;
+    file.write(out.data(), static_cast<std::streamsize>(out.size()));
+    return static_cast<bool>(file);
+}
+
+bool Replay::loadFromFile(const std::string &path, Replay &out, std::string &error)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        error = "cannot open " + path;
+        return false;
+    }
+    const std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    if (data.size() < sizeof(MAGIC) || std::memcmp(data.data(), MAGIC, sizeof(MAGIC)) != 0)
+    {
+        error = "not a replay file";
+        return false;
+    }
+
+    Reader in{data, sizeof(MAGIC)};
+    const std::uint16_t version = in.u16();
+    if (version < 1 || version > FORMAT_VERSION)
+    {
+        error = "unsupported replay version " + std::to_string(version);
+        return false;
+    }
+
+    Replay r;
+    const std::uint8_t mode = in.u8();
+    const std::uint8_t difficulty = in.u8();
+    r.header.simulationHz = in.u16();
+    r.header.seed = in.u32();
+    const std::uint32_t tickCount = in.u32();
+
+    if (!in.ok || mode > static_cast<std::uint8_t>(ReplayMode::Reborn) ||
+        difficulty > static_cast<std::uint8_t>(Difficulty::Hard) || r.header.simulationHz <= 0)
+    {
+        error = "corrupt replay header";
+        return false;
+    }
+    r.header.mode = static_cast<ReplayMode>(mode);
+    r.header.difficulty = static_cast<Difficulty>(difficulty);
+
+    if (version >= 3)
+    {
+        const std::uint64_t rows = in.u32();
+        const std::uint64_t cols = in.u32();
+        if (!in.ok || (rows == 0) != (cols == 0) || rows * cols > data.size() - in.pos)
+        {
+            error = "corrupt replay level";
+            return false;
+        }
+        r.header.level.rows = static_cast<int>(rows);
+        r.header.level.cols = static_cast<int>(cols);
+        r.header.level.hp.assign(data.begin() + static_cast<std::ptrdiff_t>(in.pos),
+                                 data.begin() + static_cast<std::ptrdiff_t>(in.pos + rows * cols));
+        in.pos += static_cast<std::size_t>(rows * cols);
+    }
+    if (version >= 4)
+        r.header.endless = in.u8() != 0;
+
+    r.ticks.reserve(tickCount);
+    Tick t;
+    const std::uint16_t allowed = AIM_CHANGED |
+                                  (r.header.mode == ReplayMode::Classic ? CLASSIC_FLAGS : REBORN_FLAGS);
+    while (in.ok && r.ticks.size() < tickCount)
+    {
+        const std::uint16_t flags = version >= 5 ? in.u16() : in.u8();
+        if (flags & ~allowed)
+        {
+            error = "corrupt replay data (unknown input flags)";
+            return false;
+        }
+        t.flags = static_cast<std::uint16_t>(flags & ~AIM_CHANGED);
+        if (flags & AIM_CHANGED)
+        {
+            t.aimX = in.f32();
+            t.aimY = in.f32();
+        }
+        if (flags & FIRE_TIMED)
+        {
+            t.fireAt = in.f32();
+            t.fireAimX = in.f32();
+            t.fireAimY = in.f32();
+        }
+        else
+        {
+            t.fireAt = 0.0f;
+        }
+        const std::uint32_t run = in.varint() + 1;
+        if (!in.ok || run > tickCount - r.ticks.size())
+            break;
+        r.ticks.insert(r.ticks.end(), run, t);
+    }
+
+    if (r.ticks.size() != tickCount)
+    {
+        error = "truncated or corrupt replay data";
+        return false;
+    }
+
+    if (version >= 2)
+    {
+        r.result.known = in.u8() != 0;
+        r.result.score = static_cast<int>(in.u32());
+        r.result.stateHash = in.u64();
+        if (!in.ok)
+        {
+            error = "truncated replay result";
+            return false;
+        }
+    }
+
+    out = std::move(r);
+    return true;
+}
+
+std::string Replay::makeDefaultPath(ReplayMode mode)
+{
+    const std::time_t now = std::time(nullptr);
+    std::tm local{};
+#if defined(_WIN32)
+    localtime_s(&local, &now);
+#else
+    localtime_r(&now, &local);
+#endif
+    char stamp[32];
+    std::strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", &local);
+
+    const std::string base = std::string("replays/") + (mode == ReplayMode::Classic ? "classic_" : "reborn_") + stamp;
+
+    // Several games can end within the same second (quick restarts)
+    std::string path = base + ".cbr";
+    std::error_code ec;
+    for (int n = 2; std::filesystem::exists(path, ec); n++)
+        path = base + "_" + std::to_string(n) + ".cbr";
+    return path;
+}
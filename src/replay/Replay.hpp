@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../core/Difficulty.hpp"
+#include "../game/ClassicSimulation.hpp"
+#include "../game_reborn/RebornSimulation.hpp"
+#include "../level/Level.hpp"
+
+enum class ReplayMode : std::uint8_t
+{
+    Classic = 0,
+    Reborn = 1,
+};
+
+/**
+ * @brief Réglages qui déterminent une partie rejouée
+ */
+struct ReplayHeader
+{
+    ReplayMode mode = ReplayMode::Classic;
+    Difficulty difficulty = Difficulty::Normal;
+    int simulationHz = 120; // le pas fixe rejoué est 1 / simulationHz
+    std::uint32_t seed = 0; // graine des tirages aléatoires des règles (Classic et Reborn n'en font pas)
+    Level level;            // grille jouée (vide : grille intégrée du mode)
+    bool endless = false;   // Reborn sans fin (les lignes générées dépendent de seed)
+
+    float stepSeconds() const { return 1.0f / static_cast<float>(simulationHz); }
+};
+
+/**
+ * @brief Fin de la partie enregistrée, pour vérifier une relecture
+ */
+struct ReplayResult
+{
+    bool known = false; // false : enregistrement sans résultat (ancien format)
+    int score = 0;
+    std::uint64_t stateHash = 0; // ClassicSimulation / RebornSimulation::stateHash()
+};
+
+/**
+ * @brief Enregistrement des entrées d'une partie, pas de simulation par pas de simulation
+ *
+ * La simulation étant déterministe, rejouer les mêmes entrées avec le même en-tête
+ * (mode, difficulté, pas fixe) reproduit la partie au bit près.
+ *
+ * Fichier (.cbr, little-endian) : en-tête fixe, puis des enregistrements
+ * [drapeaux][visée 2 x f32 si elle a changé][répétitions varint], où les pas
+ * identiques consécutifs sont regroupés : une partie de plusieurs minutes tient en
+ * quelques kilo-octets. Depuis la version 2, le résultat attendu (score, empreinte
+ * de l'état final) suit les entrées ; depuis la version 3, la grille du niveau joué
+ * suit l'en-tête, puis (version 4) le mode sans fin. Version 5 : drapeaux sur u16 (u8
+ * avant), et un appui daté (Reborn) ajoute à son pas l'instant et le point visé du tir
+ * (3 x f32). Un drapeau inconnu ou d'un autre mode rend le fichier invalide.
+ */
+class Replay
+{
+public:
+    ReplayHeader header;
+    ReplayResult result;
+
+    void clear()
+    {
+        ticks.clear();
+        result = ReplayResult();
+    }
+
+    void record(const ClassicInput &input);
+    void record(const RebornInput &input);
+
+    std::size_t size() const { return ticks.size(); }
+    bool empty() const { return ticks.empty(); }
+
+    ClassicInput classicInput(std::size_t tick) const;
+    RebornInput rebornInput(std::size_t tick) const;
+
+    /**
+     * @brief Écrit le fichier (crée le dossier parent si besoin)
+     */
+    bool saveToFile(const std::string &path) const;
+
+    /**
+     * @brief Lit un fichier ; en cas d'échec, error décrit le problème
+     */
+    static bool loadFromFile(const std::string &path, Replay &out, std::string &error);
+
+    /**
+     * @brief Chemin horodaté pour un nouvel enregistrement : replays/<mode>_AAAAMMJJ_HHMMSS.cbr
+     */
+    static std::string makeDefaultPath(ReplayMode mode);
+
+private:
+    struct Tick
+    {
+        std::uint16_t flags = 0;
+        float aimX = 0.0f;
+        float aimY = 0.0f;
+        float fireAt = 0.0f; // Reborn, timed press only
+        float fireAimX = 0.0f;
+        float fireAimY = 0.0f;
+    };
+
+    std::vector<Tick> ticks;
+};
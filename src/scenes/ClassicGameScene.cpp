@@ -1,105 +1,23 @@
 #include "../app/App.hpp"
 #include "../ui/Button.hpp"
 
-#include "../game/Ball.hpp"
-#include "../game/Paddle.hpp"
-#include "../game/Brick.hpp"
+#include "../game/ClassicSimulation.hpp"
+#include "../core/Trace.hpp"
+#include "../render/BrickLayer.hpp"
+#include "../render/ObjectRenderer.hpp"
+#include "../replay/Replay.hpp"
 
 #include <SFML/Graphics.hpp>
 
-#include <algorithm>
-#include <cmath>
+#include <iostream>
 #include <memory>
+#include <random>
 #include <sstream>
-#include <vector>
 
 namespace
 {
-constexpr float WINDOW_W = 800.0f;
-constexpr float WINDOW_H = 600.0f;
-
-constexpr float PADDLE_W = 110.0f;
-constexpr float PADDLE_H = 20.0f;
-constexpr float BALL_R = 8.0f;
-
-constexpr int BRICK_ROWS = 6;
-constexpr int BRICK_COLS = 10;
-
-int startingLives(Difficulty d)
-{
-    switch (d)
-    {
-    case Difficulty::Easy:
-        return 5;
-    case Difficulty::Hard:
-        return 2;
-    case Difficulty::Normal:
-    default:
-        return 3;
-    }
-}
-
-float baseBallSpeed(Difficulty d)
-{
-    switch (d)
-    {
-    case Difficulty::Easy:
-        return 260.0f;
-    case Difficulty::Hard:
-        return 360.0f;
-    case Difficulty::Normal:
-    default:
-        return 300.0f;
-    }
-}
-
-float difficultyRamp(Difficulty d)
-{
-    switch (d)
-    {
-    case Difficulty::Easy:
-        return 1.06f;
-    case Difficulty::Hard:
-        return 1.14f;
-    case Difficulty::Normal:
-    default:
-        return 1.10f;
-    }
-}
-
-void reflectBallOnAABB(Ball &ball, const AABB &box)
-{
-    const sf::Vector2f c = ball.getPosition();
-    const float r = ball.getRadius();
-
-    const float boxCx = (box.left + box.right) * 0.5f;
-    const float boxCy = (box.top + box.bottom) * 0.5f;
-    const float halfW = (box.right - box.left) * 0.5f;
-    const float halfH = (box.bottom - box.top) * 0.5f;
-
-    const float dx = c.x - boxCx;
-    const float dy = c.y - boxCy;
-
-    const float px = (halfW + r) - std::abs(dx);
-    const float py = (halfH + r) - std::abs(dy);
-
-    sf::Vector2f v = ball.getVelocity();
-    if (px < py)
-    {
-        // Hit left/right
-        v.x = -v.x;
-        // Push out slightly to avoid sticking
-        ball.setPosition(c.x + (dx < 0 ? -px : px), c.y);
-    }
-    else
-    {
-        // Hit top/bottom
-        v.y = -v.y;
-        ball.setPosition(c.x, c.y + (dy < 0 ? -py : py));
-    }
-    ball.setVelocity(v);
-}
-
+constexpr float WINDOW_W = ClassicSimulation::FIELD_W;
+constexpr float WINDOW_H = ClassicSimulation::FIELD_H;
 } // namespace
 
 class ClassicGameScene final : public IScene
@@ -107,11 +25,20 @@ class ClassicGameScene final : public IScene
 public:
     explicit ClassicGameScene(AppContext &ctx)
         : IScene(ctx),
-          paddle(WINDOW_W / 2.0f - PADDLE_W / 2.0f, WINDOW_H - 60.0f, PADDLE_W, PADDLE_H, WINDOW_W, 520.0f),
-          ball(WINDOW_W / 2.0f, WINDOW_H - 100.0f, BALL_R, WINDOW_W, WINDOW_H, baseBallSpeed(ctx.settings.difficulty))
+          replaying(ctx.launch.playReplay && ctx.launch.replay.header.mode == ReplayMode::Classic),
+          sim(replaying ? ctx.launch.replay.header.difficulty : ctx.settings.difficulty,
+              replaying ? ctx.launch.replay.header.level.grid() : ctx.assets.startLevel())
     {
-        lives = startingLives(ctx.settings.difficulty);
-        resetLevel();
+        if (replaying)
+        {
+            // Consume the command-line replay: back to normal play on the next visit
+            replay = std::move(ctx.launch.replay);
+            ctx.launch.playReplay = false;
+        }
+        else
+        {
+            startRecording();
+        }
 
         // Overlay buttons use shared font
         const sf::Font *font = ctx.assets.uiFontLoaded ? &ctx.assets.uiFont : nullptr;
@@ -120,50 +47,34 @@ public:
         btnBack = Button(font, "Back to Menu", {WINDOW_W / 2.0f - 140.0f, WINDOW_H / 2.0f + 150.0f}, {280.0f, 56.0f});
     }
 
-    void handleEvent(const sf::Event &event) override
+    ~ClassicGameScene() override
     {
-        if (event.type == sf::Event::KeyPressed)
-        {
-            if (event.key.code == sf::Keyboard::Escape)
-            {
-                if (state == State::Playing)
-                    state = State::Paused;
-                else if (state == State::Paused)
-                    state = State::Playing;
-            }
-
-            if (event.key.code == sf::Keyboard::Space)
-            {
-                if (state == State::Playing && !ballLaunched)
-                    launchBall();
-                else if (state == State::Win || state == State::Lose)
-                    resetAll();
-            }
-        }
+        saveRecording();
+    }
+
+    void update(float dt, const InputSnapshot &input) override
+    {
+        TRACE_SCOPE("ClassicGameScene::update");
 
-        if (event.type == sf::Event::MouseButtonPressed)
+        const bool gameOver = sim.getState() != ClassicSimulation::State::Playing;
+        if (input.wasPressed(sf::Keyboard::Escape) && !gameOver)
+            paused = !paused;
+        if (input.wasPressed(sf::Keyboard::Space) && gameOver)
         {
-            if (event.mouseButton.button == sf::Mouse::Left && state == State::Playing && !ballLaunched)
-                launchBall();
+            resetAll();
+            return; // the same Space must not also launch the new ball
         }
-    }
 
-    void update(float dt) override
-    {
         // Mouse interaction for overlays
-        const sf::Vector2i mp = sf::Mouse::getPosition(ctx.window);
-        const sf::Vector2f mpos(static_cast<float>(mp.x), static_cast<float>(mp.y));
-        const bool mouseDown = sf::Mouse::isButtonPressed(sf::Mouse::Left);
-
-        if (state == State::Paused || state == State::Win || state == State::Lose)
+        if (paused || gameOver)
         {
-            btnResume.setSelected(state == State::Paused);
-            btnResume.update(mpos, mouseDown);
-            btnRestart.update(mpos, mouseDown);
-            btnBack.update(mpos, mouseDown);
+            btnResume.setSelected(paused);
+            btnResume.update(input);
+            btnRestart.update(input);
+            btnBack.update(input);
 
-            if (btnResume.consumeClick() && state == State::Paused)
-                state = State::Playing;
+            if (btnResume.consumeClick() && paused)
+                paused = false;
             if (btnRestart.consumeClick())
                 resetAll();
             if (btnBack.consumeClick())
@@ -171,189 +82,199 @@ public:
             return;
         }
 
-        // Movement
-        const bool left = sf::Keyboard::isKeyPressed(sf::Keyboard::Left) || sf::Keyboard::isKeyPressed(sf::Keyboard::A);
-        const bool right = sf::Keyboard::isKeyPressed(sf::Keyboard::Right) || sf::Keyboard::isKeyPressed(sf::Keyboard::D);
-        paddle.update(dt, left, right);
-
-        // Ball behavior
-        if (!ballLaunched)
+        if (replaying)
         {
-            // Stick ball on paddle
-            const sf::Vector2f p = paddle.getPosition();
-            ball.setPosition(p.x + PADDLE_W / 2.0f, p.y - BALL_R - 1.0f);
+            // Recorded step size, not ours: the playback is exact whatever simulationHz is now
+            if (!replayFinished())
+                sim.step(replay.header.stepSeconds(), replay.classicInput(replayTick++));
             return;
         }
 
-        // Difficulty ramp over time (classic feel)
-        rampTimer += dt;
-        if (rampTimer >= 10.0f)
-        {
-            ball.increaseSpeed(difficultyRamp(ctx.settings.difficulty));
-            rampTimer = 0.0f;
-        }
-
-        ball.update(dt);
+        ClassicInput step;
+        step.moveLeft = input.isDown(sf::Keyboard::Left) || input.isDown(sf::Keyboard::A);
+        step.moveRight = input.isDown(sf::Keyboard::Right) || input.isDown(sf::Keyboard::D);
+        step.launch = !sim.isBallLaunched() &&
+                      (input.wasPressed(sf::Keyboard::Space) || input.wasPressed(sf::Mouse::Left));
 
-        // Paddle collision: nudge out to avoid sticking
-        if (ball.checkCollision(paddle))
-        {
-            ball.bounceOnPaddle(paddle.getPosition().x, PADDLE_W);
-            ball.setPosition(ball.getPosition().x, paddle.getPosition().y - BALL_R - 1.0f);
-        }
+        if (recording)
+            replay.record(step);
+        sim.step(dt, step);
 
-        // Brick collisions: reflect properly by contact side
-        for (auto &b : bricks)
-        {
-            if (b.isDestroyed())
-                continue;
-            if (ball.checkCollision(b))
-            {
-                reflectBallOnAABB(ball, b.getAABB());
-                score += b.getPoints();
-                b.destroy();
-                break;
-            }
-        }
-
-        // Lose a life
-        if (ball.isLost())
-        {
-            lives--;
-            ballLaunched = false;
+        if (sim.getState() != ClassicSimulation::State::Playing)
+            saveRecording();
+    }
 
-            if (lives <= 0)
-            {
-                state = State::Lose;
-            }
-        }
+    std::unique_ptr<SceneFrame> createFrame() const override
+    {
+        return std::make_unique<Frame>();
+    }
 
-        // Win condition
-        if (std::all_of(bricks.begin(), bricks.end(), [](const ClassicGame::Brick &b)
-                        { return b.isDestroyed(); }))
-        {
-            state = State::Win;
-        }
+    void capture(SceneFrame &frame) const override
+    {
+        TRACE_SCOPE("ClassicGameScene::capture");
+
+        Frame &f = static_cast<Frame &>(frame);
+        f.bricks = sim.getBricks(); // reuses the frame's arrays
+        f.paddle = Render::ObjectSnapshot::of(sim.getPaddle());
+        f.ball = Render::ObjectSnapshot::of(sim.getBall());
+
+        f.state = sim.getState();
+        f.score = sim.getScore();
+        f.lives = sim.getLives();
+        f.ballLaunched = sim.isBallLaunched();
+        f.paused = paused;
+        f.replaying = replaying;
+        f.replayTick = replayTick;
+        f.replaySize = replay.size();
+        f.frozen = paused || sim.getState() != ClassicSimulation::State::Playing || replayFinished();
+
+        f.resume = btnResume.getLook();
+        f.restart = btnRestart.getLook();
+        f.back = btnBack.getLook();
     }
 
-    void render(sf::RenderTarget &target) override
+    void render(sf::RenderTarget &target, const SceneFrame &frame, float alpha) override
     {
-        // Background
-        sf::RectangleShape bg(sf::Vector2f(WINDOW_W, WINDOW_H));
-        bg.setFillColor(sf::Color(10, 10, 18));
-        target.draw(bg);
+        TRACE_SCOPE("ClassicGameScene::render");
 
-        // Bricks
-        for (auto &b : bricks)
-            if (!b.isDestroyed())
-                b.draw(static_cast<sf::RenderWindow &>(target));
+        const Frame &f = static_cast<const Frame &>(frame);
 
-        // Paddle + ball
-        paddle.draw(static_cast<sf::RenderWindow &>(target));
-        ball.draw(static_cast<sf::RenderWindow &>(target));
+        // Frozen simulation: draw the current state, not a blend with the previous step
+        if (f.frozen)
+            alpha = 1.0f;
 
-        drawHud(target);
+        target.clear(sf::Color(10, 10, 18));
 
-        if (state == State::Paused)
+        // Bricks: cached layer, redrawn only where a brick was destroyed
+        brickLayer.draw(target, f.bricks);
+
+        // Paddle + ball in one draw call
+        batch.clear();
+        batch.addObject(f.paddle, alpha);
+        batch.addObject(f.ball, alpha);
+        batch.flush(target);
+
+        drawHud(target, f);
+
+        if (f.paused)
         {
             drawOverlay(target, "PAUSED", "Resume / Restart / Back");
-            btnResume.render(target);
-            btnRestart.render(target);
-            btnBack.render(target);
+            btnResume.render(target, f.resume);
+            btnRestart.render(target, f.restart);
+            btnBack.render(target, f.back);
         }
-        else if (state == State::Win)
+        else if (f.state == ClassicSimulation::State::Win)
         {
             drawOverlay(target, "VICTORY!", "Space: Restart");
-            btnRestart.render(target);
-            btnBack.render(target);
+            btnRestart.render(target, f.restart);
+            btnBack.render(target, f.back);
         }
-        else if (state == State::Lose)
+        else if (f.state == ClassicSimulation::State::Lose)
         {
             drawOverlay(target, "DEFEAT", "Space: Restart");
-            btnRestart.render(target);
-            btnBack.render(target);
+            btnRestart.render(target, f.restart);
+            btnBack.render(target, f.back);
         }
     }
 
 private:
-    enum class State
-    {
-        Playing,
-        Paused,
-        Win,
-        Lose,
-    };
+    // Declared before sim: a replay decides the difficulty and level it is built with
+    bool replaying = false;
+    ClassicSimulation sim;
 
-    Paddle paddle;
-    Ball ball;
-    std::vector<ClassicGame::Brick> bricks;
+    Replay replay;
+    std::size_t replayTick = 0;
+    bool recording = false; // inputs not saved yet
 
-    int score = 0;
-    int lives = 3;
-    bool ballLaunched = false;
-    float rampTimer = 0.0f;
-    State state = State::Playing;
+    Render::BrickLayer brickLayer;
+    Render::ShapeBatch batch;
+
+    bool paused = false;
 
     Button btnResume;
     Button btnRestart;
     Button btnBack;
 
-    void resetLevel()
+    struct Frame : SceneFrame
+    {
+        BrickField bricks;
+        Render::ObjectSnapshot paddle;
+        Render::ObjectSnapshot ball;
+
+        // HUD
+        ClassicSimulation::State state = ClassicSimulation::State::Playing;
+        int score = 0;
+        int lives = 0;
+        bool ballLaunched = false;
+        bool paused = false;
+        bool replaying = false;
+        std::size_t replayTick = 0;
+        std::size_t replaySize = 0;
+        bool frozen = false; // no step is running: draw without interpolation
+
+        Button::Look resume;
+        Button::Look restart;
+        Button::Look back;
+    };
+
+    void resetAll()
     {
-        bricks.clear();
-        score = 0;
-        rampTimer = 0.0f;
-        ballLaunched = false;
-        state = State::Playing;
-
-        const float brickW = 72.0f;
-        const float brickH = 28.0f;
-        const float spacing = 6.0f;
-        const float totalW = BRICK_COLS * brickW + (BRICK_COLS - 1) * spacing;
-        const float startX = (WINDOW_W - totalW) / 2.0f;
-        const float startY = 80.0f;
-
-        sf::Color colors[] = {
-            sf::Color(255, 90, 90),
-            sf::Color(255, 170, 70),
-            sf::Color(255, 230, 90),
-            sf::Color(110, 220, 140),
-            sf::Color(90, 190, 255),
-            sf::Color(180, 140, 255),
-        };
-
-        for (int r = 0; r < BRICK_ROWS; r++)
+        sim.resetAll();
+        paused = false;
+
+        // Restart: replay from the start, or keep the abandoned game and record a new one
+        replayTick = 0;
+        if (!replaying)
         {
-            for (int c = 0; c < BRICK_COLS; c++)
-            {
-                const float x = startX + c * (brickW + spacing);
-                const float y = startY + r * (brickH + spacing);
-                const int pts = (BRICK_ROWS - r) * 10;
-                bricks.emplace_back(x, y, brickW, brickH, colors[r % 6], pts);
-            }
+            saveRecording();
+            startRecording();
         }
     }
 
-    void resetAll()
+    bool replayFinished() const
+    {
+        return replaying && replayTick >= replay.size();
+    }
+
+    void startRecording()
     {
-        lives = startingLives(ctx.settings.difficulty);
-        resetLevel();
+        recording = ctx.settings.recordReplays;
+        replay.clear();
+        replay.header.mode = ReplayMode::Classic;
+        replay.header.difficulty = ctx.settings.difficulty;
+        replay.header.simulationHz = ctx.settings.simulationHz;
+        replay.header.seed = std::random_device{}();
+        replay.header.level = Level(sim.getLevel());
     }
 
-    void launchBall()
+    void saveRecording()
     {
-        ballLaunched = true;
-        const float spd = baseBallSpeed(ctx.settings.difficulty);
-        ball.setVelocity(spd * 0.55f, -spd);
+        if (!recording)
+            return;
+        recording = false;
+        if (replay.empty())
+            return;
+
+        replay.result.known = true;
+        replay.result.score = sim.getScore();
+        replay.result.stateHash = sim.stateHash();
+
+        const std::string path = Replay::makeDefaultPath(ReplayMode::Classic);
+        if (!replay.saveToFile(path))
+            std::cerr << "Cannot write replay " << path << "\n";
     }
 
-    void drawHud(sf::RenderTarget &target)
+    void drawHud(sf::RenderTarget &target, const Frame &f)
     {
         if (!ctx.assets.uiFontLoaded)
             return;
 
         std::ostringstream ss;
-        ss << "Score: " << score << "    Lives: " << lives << (ballLaunched ? "" : "    (Space to launch)");
+        ss << "Score: " << f.score << "    Lives: " << f.lives;
+        if (f.replaying)
+            ss << "    REPLAY " << f.replayTick << "/" << f.replaySize;
+        else if (!f.ballLaunched)
+            ss << "    (Space to launch)";
 
         sf::Text t(ss.str(), ctx.assets.uiFont, 18);
         t.setFillColor(sf::Color(220, 220, 235));
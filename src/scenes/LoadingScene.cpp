@@ -0,0 +1,105 @@
+#include "../app/App.hpp"
+
+#include "../core/Trace.hpp"
+
+#include <SFML/Graphics.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <memory>
+
+namespace
+{
+    constexpr float WINDOW_W = 800.0f;
+    constexpr float WINDOW_H = 600.0f;
+
+    constexpr float BAR_W = 360.0f;
+    constexpr float BAR_H = 10.0f;
+} // namespace
+
+// First scene of every launch: assets load on a worker thread (Assets::initAsync) while
+// this draws a progress bar with plain shapes (no font yet). Once they are in, the glyph
+// caches are warmed by render() (font textures belong to the window thread), and the
+// requested start scene opens on the next step.
+class LoadingScene final : public IScene
+{
+public:
+    explicit LoadingScene(AppContext &ctx)
+        : IScene(ctx)
+    {
+    }
+
+    void update(float dt, const InputSnapshot &) override
+    {
+        TRACE_SCOPE("LoadingScene::update");
+
+        elapsed += dt;
+        if (!ready)
+            ready = ctx.assets.isReady();
+        else if (glyphsWarm.load(std::memory_order_acquire))
+            ctx.requestedScene = ctx.launch.startScene;
+    }
+
+    std::unique_ptr<SceneFrame> createFrame() const override
+    {
+        return std::make_unique<Frame>();
+    }
+
+    void capture(SceneFrame &frame) const override
+    {
+        Frame &f = static_cast<Frame &>(frame);
+        f.progress = ctx.assets.progress();
+        f.elapsed = elapsed;
+        f.ready = ready;
+    }
+
+    void render(sf::RenderTarget &target, const SceneFrame &frame, float) override
+    {
+        const Frame &f = static_cast<const Frame &>(frame);
+        if (f.ready && !glyphsWarm.load(std::memory_order_relaxed))
+        {
+            StartupProfile::Phase phase(ctx.startup, "glyphs");
+            ctx.assets.prewarmGlyphs();
+            glyphsWarm.store(true, std::memory_order_release);
+        }
+
+        const float x = (WINDOW_W - BAR_W) / 2.0f;
+        const float y = WINDOW_H / 2.0f;
+
+        sf::RectangleShape bar(sf::Vector2f(BAR_W, BAR_H));
+        bar.setPosition(x, y);
+        bar.setFillColor(sf::Color(0, 0, 0, 140));
+        bar.setOutlineThickness(1.0f);
+        bar.setOutlineColor(sf::Color(255, 200, 0, 180));
+        target.draw(bar);
+
+        sf::RectangleShape fill(sf::Vector2f(BAR_W * f.progress, BAR_H));
+        fill.setPosition(x, y);
+        fill.setFillColor(sf::Color(255, 200, 0, 200));
+        target.draw(fill);
+
+        // Sweeping brick: shows the window is alive even when a step takes a while
+        const float t = 0.5f + 0.5f * std::sin(f.elapsed * 3.0f);
+        sf::RectangleShape brick(sf::Vector2f(36.0f, 14.0f));
+        brick.setPosition(x + (BAR_W - 36.0f) * t, y - 30.0f);
+        brick.setFillColor(sf::Color(90, 190, 255));
+        target.draw(brick);
+    }
+
+private:
+    struct Frame : SceneFrame
+    {
+        float progress = 0.0f;
+        float elapsed = 0.0f;
+        bool ready = false;
+    };
+
+    float elapsed = 0.0f;
+    bool ready = false;                  // assets in (the loader thread is joined)
+    std::atomic<bool> glyphsWarm{false}; // set by render()
+};
+
+std::unique_ptr<IScene> makeLoadingScene(AppContext &ctx)
+{
+    return std::make_unique<LoadingScene>(ctx);
+}
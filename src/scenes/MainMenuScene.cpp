@@ -2,6 +2,7 @@
 #include "../ui/Button.hpp"
 
 #include <SFML/Graphics.hpp>
+#include <array>
 #include <memory>
 
 class MainMenuScene final : public IScene
@@ -34,15 +35,17 @@ public:
         }
 
         const float w = 460.0f;
-        const float h = 60.0f;
+        const float h = 48.0f;
         const float x = 400.0f - w / 2.0f;
-        const float y0 = 230.0f;
-        const float dy = 78.0f;
+        const float y0 = 210.0f;
+        const float dy = 57.0f;
 
         btnClassic = Button(font, "Start - Classic", {x, y0 + dy * 0}, {w, h});
         btnReborn = Button(font, "Start - Reborn", {x, y0 + dy * 1}, {w, h});
-        btnSettings = Button(font, "Settings", {x, y0 + dy * 2}, {w, h});
-        btnQuit = Button(font, "Quit", {x, y0 + dy * 3}, {w, h});
+        btnEndless = Button(font, "Start - Reborn Endless", {x, y0 + dy * 2}, {w, h});
+        btnStress = Button(font, "Stress Test", {x, y0 + dy * 3}, {w, h});
+        btnSettings = Button(font, "Settings", {x, y0 + dy * 4}, {w, h});
+        btnQuit = Button(font, "Quit", {x, y0 + dy * 5}, {w, h});
 
         setSelected(0);
     }
@@ -53,30 +56,32 @@ public:
             return;
 
         if (event.key.code == sf::Keyboard::Up)
-            setSelected((selected + 3) % 4);
+            setSelected((selected + BUTTON_COUNT - 1) % BUTTON_COUNT);
         else if (event.key.code == sf::Keyboard::Down)
-            setSelected((selected + 1) % 4);
+            setSelected((selected + 1) % BUTTON_COUNT);
         else if (event.key.code == sf::Keyboard::Escape)
             ctx.requestedScene = SceneId::Quit;
         else if (event.key.code == sf::Keyboard::Enter || event.key.code == sf::Keyboard::Space)
             activateSelected();
     }
 
-    void update(float) override
+    void update(float, const InputSnapshot &input) override
     {
-        const sf::Vector2i mp = sf::Mouse::getPosition(ctx.window);
-        const sf::Vector2f mpos(static_cast<float>(mp.x), static_cast<float>(mp.y));
-        const bool mouseDown = sf::Mouse::isButtonPressed(sf::Mouse::Left);
-
-        btnClassic.update(mpos, mouseDown);
-        btnReborn.update(mpos, mouseDown);
-        btnSettings.update(mpos, mouseDown);
-        btnQuit.update(mpos, mouseDown);
+        btnClassic.update(input);
+        btnReborn.update(input);
+        btnEndless.update(input);
+        btnStress.update(input);
+        btnSettings.update(input);
+        btnQuit.update(input);
 
         if (btnClassic.consumeClick())
             ctx.requestedScene = SceneId::ClassicGame;
         else if (btnReborn.consumeClick())
             ctx.requestedScene = SceneId::RebornGame;
+        else if (btnEndless.consumeClick())
+            ctx.requestedScene = SceneId::RebornEndless;
+        else if (btnStress.consumeClick())
+            ctx.requestedScene = SceneId::Stress;
         else if (btnSettings.consumeClick())
             ctx.requestedScene = SceneId::Settings;
         else if (btnQuit.consumeClick())
@@ -87,14 +92,32 @@ public:
             setSelected(0);
         else if (btnReborn.isHovered())
             setSelected(1);
-        else if (btnSettings.isHovered())
+        else if (btnEndless.isHovered())
             setSelected(2);
-        else if (btnQuit.isHovered())
+        else if (btnStress.isHovered())
             setSelected(3);
+        else if (btnSettings.isHovered())
+            setSelected(4);
+        else if (btnQuit.isHovered())
+            setSelected(5);
+    }
+
+    std::unique_ptr<SceneFrame> createFrame() const override
+    {
+        return std::make_unique<Frame>();
+    }
+
+    void capture(SceneFrame &frame) const override
+    {
+        Frame &f = static_cast<Frame &>(frame);
+        for (int i = 0; i < BUTTON_COUNT; i++)
+            f.looks[i] = buttons[i]->getLook();
     }
 
-    void render(sf::RenderTarget &target) override
+    void render(sf::RenderTarget &target, const SceneFrame &frame, float) override
     {
+        const Frame &f = static_cast<const Frame &>(frame);
+
         // Decorative line
         sf::RectangleShape top(sf::Vector2f(800.0f, 3.0f));
         top.setFillColor(sf::Color(255, 200, 0));
@@ -111,10 +134,8 @@ public:
         sep.setFillColor(sf::Color(90, 90, 110));
         target.draw(sep);
 
-        btnClassic.render(target);
-        btnReborn.render(target);
-        btnSettings.render(target);
-        btnQuit.render(target);
+        for (int i = 0; i < BUTTON_COUNT; i++)
+            buttons[i]->render(target, f.looks[i]);
 
         if (ctx.assets.uiFontLoaded)
         {
@@ -133,18 +154,29 @@ private:
 
     Button btnClassic;
     Button btnReborn;
+    Button btnEndless;
+    Button btnStress;
     Button btnSettings;
     Button btnQuit;
 
+    static constexpr int BUTTON_COUNT = 6;
+    const std::array<Button *, BUTTON_COUNT> buttons{&btnClassic, &btnReborn, &btnEndless, &btnStress, &btnSettings, &btnQuit};
     int selected = 0;
 
+    struct Frame : SceneFrame
+    {
+        std::array<Button::Look, BUTTON_COUNT> looks;
+    };
+
     void setSelected(int i)
     {
         selected = i;
         btnClassic.setSelected(selected == 0);
         btnReborn.setSelected(selected == 1);
-        btnSettings.setSelected(selected == 2);
-        btnQuit.setSelected(selected == 3);
+        btnEndless.setSelected(selected == 2);
+        btnStress.setSelected(selected == 3);
+        btnSettings.setSelected(selected == 4);
+        btnQuit.setSelected(selected == 5);
     }
 
     void activateSelected()
@@ -158,9 +190,15 @@ private:
             ctx.requestedScene = SceneId::RebornGame;
             break;
         case 2:
-            ctx.requestedScene = SceneId::Settings;
+            ctx.requestedScene = SceneId::RebornEndless;
             break;
         case 3:
+            ctx.requestedScene = SceneId::Stress;
+            break;
+        case 4:
+            ctx.requestedScene = SceneId::Settings;
+            break;
+        case 5:
         default:
             ctx.requestedScene = SceneId::Quit;
             break;
@@ -1,121 +1,34 @@
 #include "../app/App.hpp"
 #include "../ui/Button.hpp"
 
-#include "../game_reborn/Brick.hpp"
-#include "../game_reborn/Cannon.hpp"
-#include "../game_reborn/Projectile.hpp"
+#include "../bots/RebornAutoplayer.hpp"
+#include "../game_reborn/RebornSimulation.hpp"
+#include "../core/Trace.hpp"
+#include "../render/BrickLayer.hpp"
+#include "../render/ObjectRenderer.hpp"
+#include "../replay/Replay.hpp"
 
 #include <SFML/Graphics.hpp>
 
 #include <algorithm>
-#include <cmath>
+#include <iomanip>
+#include <iostream>
 #include <memory>
+#include <random>
 #include <sstream>
 #include <string>
 #include <vector>
 
 namespace
 {
-    constexpr float WINDOW_W = 800.0f;
-    constexpr float WINDOW_H = 600.0f;
+    constexpr float WINDOW_W = RebornSimulation::FIELD_W;
+    constexpr float WINDOW_H = RebornSimulation::FIELD_H;
 
-    constexpr int BRICK_ROWS = 6;
-    constexpr int BRICK_COLS = 10;
+    constexpr float AUTOPLAY_RESTART_DELAY = 3.0f; // seconds on the end screen before the bot plays again
 
-    int projectileBudget(Difficulty d)
-    {
-        switch (d)
-        {
-        case Difficulty::Easy:
-            return 70;
-        case Difficulty::Hard:
-            return 35;
-        case Difficulty::Normal:
-        default:
-            return 50;
-        }
-    }
-
-    float projectileSpeed(Difficulty d)
-    {
-        switch (d)
-        {
-        case Difficulty::Easy:
-            return 460.0f;
-        case Difficulty::Hard:
-            return 560.0f;
-        case Difficulty::Normal:
-        default:
-            return 500.0f;
-        }
-    }
-
-    int brickHpForRow(Difficulty d, int rowFromTop)
-    {
-        // rowFromTop: 0..rows-1, top row hardest
-        int base = 1 + (BRICK_ROWS - 1 - rowFromTop) / 2; // 1..3-ish
-        if (d == Difficulty::Easy)
-            base = std::max(1, base - 1);
-        if (d == Difficulty::Hard)
-            base = std::min(4, base + 1);
-        return std::max(1, std::min(4, base));
-    }
-
-    int maxActiveShots(Difficulty d)
-    {
-        switch (d)
-        {
-        case Difficulty::Easy:
-            return 5;
-        case Difficulty::Hard:
-            return 3;
-        case Difficulty::Normal:
-        default:
-            return 4;
-        }
-    }
-
-    float fireCooldownSeconds(Difficulty d)
-    {
-        switch (d)
-        {
-        case Difficulty::Easy:
-            return 0.18f;
-        case Difficulty::Hard:
-            return 0.28f;
-        case Difficulty::Normal:
-        default:
-            return 0.22f;
-        }
-    }
-
-    float brickDescendSpeed(Difficulty d)
-    {
-        switch (d)
-        {
-        case Difficulty::Easy:
-            return 8.0f;
-        case Difficulty::Hard:
-            return 14.0f;
-        case Difficulty::Normal:
-        default:
-            return 11.0f;
-        }
-    }
-
-    int shotCost(Projectile::ShotType t)
-    {
-        switch (t)
-        {
-        case Projectile::ShotType::Piercing:
-            return 2;
-        case Projectile::ShotType::Explosive:
-            return 3;
-        case Projectile::ShotType::Normal:
-        default:
-            return 1;
-        }
-    }
+    // An endless (or bot-played) game has no end: its recording is saved and stopped here,
+    // with the state reached then, so it still replays to a known result
+    constexpr int MAX_RECORDED_SECONDS = 20 * 60;
 
     const char *shotName(Projectile::ShotType t)
     {
@@ -136,68 +49,31 @@ namespace
         return std::max(lo, std::min(v, hi));
     }
 
-    bool circleRectCollisionNormal(const Projectile &p, const RebornGame::Brick &b, sf::Vector2f &outNormal, float &outPenetration)
-    {
-        const sf::Vector2f c = p.getPosition();
-        const float r = p.getRadius();
-        const AABB box = b.getAABB();
-
-        const float closestX = clampf(c.x, box.left, box.right);
-        const float closestY = clampf(c.y, box.top, box.bottom);
-
-        float dx = c.x - closestX;
-        float dy = c.y - closestY;
-        const float d2 = dx * dx + dy * dy;
-
-        // If outside / touching but not intersecting, no collision
-        if (d2 >= r * r)
-            return false;
-
-        // If the circle center is inside the rectangle (dx=dy=0), choose the nearest side.
-        if (dx == 0.0f && dy == 0.0f)
-        {
-            const float distLeft = c.x - box.left;
-            const float distRight = box.right - c.x;
-            const float distTop = c.y - box.top;
-            const float distBottom = box.bottom - c.y;
-
-            const float minDist = std::min(std::min(distLeft, distRight), std::min(distTop, distBottom));
-            if (minDist == distLeft)
-                outNormal = sf::Vector2f(-1.0f, 0.0f);
-            else if (minDist == distRight)
-                outNormal = sf::Vector2f(1.0f, 0.0f);
-            else if (minDist == distTop)
-                outNormal = sf::Vector2f(0.0f, -1.0f);
-            else
-                outNormal = sf::Vector2f(0.0f, 1.0f);
-
-            outPenetration = r + 1.0f;
-            return true;
-        }
-
-        const float d = std::sqrt(d2);
-        outNormal = sf::Vector2f(dx / d, dy / d);
-        outPenetration = r - d;
-        return true;
-    }
-
-    sf::Vector2f reflect(const sf::Vector2f &v, const sf::Vector2f &n)
-    {
-        const float dot = v.x * n.x + v.y * n.y;
-        return sf::Vector2f(v.x - 2.0f * dot * n.x, v.y - 2.0f * dot * n.y);
-    }
-
 } // namespace
 
 class RebornGameScene final : public IScene
 {
 public:
-    explicit RebornGameScene(AppContext &ctx)
+    RebornGameScene(AppContext &ctx, RebornSimulation::Mode mode)
         : IScene(ctx),
-          cannon(WINDOW_W, WINDOW_H)
+          replaying(ctx.launch.playReplay && ctx.launch.replay.header.mode == ReplayMode::Reborn),
+          sim(replaying ? ctx.launch.replay.header.difficulty : ctx.settings.difficulty,
+              replaying ? ctx.launch.replay.header.level.grid() : ctx.assets.startLevel(),
+              replaying ? (ctx.launch.replay.header.endless ? RebornSimulation::Mode::Endless : RebornSimulation::Mode::Standard) : mode,
+              replaying ? ctx.launch.replay.header.seed : std::random_device{}())
     {
-        budget = projectileBudget(ctx.settings.difficulty);
-        resetLevel();
+        if (replaying)
+        {
+            // Consume the command-line replay: back to normal play on the next visit
+            replay = std::move(ctx.launch.replay);
+            ctx.launch.playReplay = false;
+        }
+        else
+        {
+            startRecording();
+            if (ctx.launch.autoplay)
+                setAutoplay(true);
+        }
 
         const sf::Font *font = ctx.assets.uiFontLoaded ? &ctx.assets.uiFont : nullptr;
         btnResume = Button(font, "Resume", {WINDOW_W / 2.0f - 140.0f, WINDOW_H / 2.0f + 10.0f}, {280.0f, 56.0f});
@@ -205,387 +81,358 @@ public:
         btnBack = Button(font, "Back to Menu", {WINDOW_W / 2.0f - 140.0f, WINDOW_H / 2.0f + 150.0f}, {280.0f, 56.0f});
     }
 
-    void handleEvent(const sf::Event &event) override
+    ~RebornGameScene() override
     {
-        if (event.type == sf::Event::KeyPressed)
-        {
-            if (event.key.code == sf::Keyboard::Escape)
-            {
-                if (state == State::Playing)
-                    state = State::Paused;
-                else if (state == State::Paused)
-                    state = State::Playing;
-            }
-
-            if (event.key.code == sf::Keyboard::Space)
-            {
-                if (state == State::Win || state == State::Lose)
-                    resetAll();
-            }
+        saveRecording();
+    }
 
-            // Shot type hotkeys
-            if (event.key.code == sf::Keyboard::Num1)
-                currentShot = Projectile::ShotType::Normal;
-            if (event.key.code == sf::Keyboard::Num2)
-                currentShot = Projectile::ShotType::Piercing;
-            if (event.key.code == sf::Keyboard::Num3)
-                currentShot = Projectile::ShotType::Explosive;
-        }
+    void update(float dt, const InputSnapshot &input) override
+    {
+        TRACE_SCOPE("RebornGameScene::update");
 
-        if (event.type == sf::Event::MouseButtonPressed)
+        const bool gameOver = sim.getState() != RebornSimulation::State::Playing;
+        if (input.wasPressed(sf::Keyboard::Escape) && !gameOver)
+            paused = !paused;
+        if (input.wasPressed(sf::Keyboard::Space) && gameOver)
         {
-            if (event.mouseButton.button == sf::Mouse::Left)
-                firingHeld = true;
-        }
-        if (event.type == sf::Event::MouseButtonReleased)
-        {
-            if (event.mouseButton.button == sf::Mouse::Left)
-                firingHeld = false;
+            resetAll();
+            return;
         }
-    }
 
-    void update(float dt) override
-    {
-        const sf::Vector2i mp = sf::Mouse::getPosition(ctx.window);
-        const sf::Vector2f mpos(static_cast<float>(mp.x), static_cast<float>(mp.y));
-        const bool mouseDown = sf::Mouse::isButtonPressed(sf::Mouse::Left);
+        // Attract mode / soak test: the look-ahead bot takes over the inputs
+        if (input.wasPressed(sf::Keyboard::Tab) && !replaying)
+            setAutoplay(!autoplayer);
 
-        if (state == State::Paused || state == State::Win || state == State::Lose)
+        // Shot type hotkeys (kept while paused, applied on the next simulation step)
+        if (input.wasPressed(sf::Keyboard::Num1))
+            selectShot(Projectile::ShotType::Normal);
+        if (input.wasPressed(sf::Keyboard::Num2))
+            selectShot(Projectile::ShotType::Piercing);
+        if (input.wasPressed(sf::Keyboard::Num3))
+            selectShot(Projectile::ShotType::Explosive);
+
+        if (paused || gameOver)
         {
-            btnResume.setSelected(state == State::Paused);
-            btnResume.update(mpos, mouseDown);
-            btnRestart.update(mpos, mouseDown);
-            btnBack.update(mpos, mouseDown);
+            btnResume.setSelected(paused);
+            btnResume.update(input);
+            btnRestart.update(input);
+            btnBack.update(input);
 
-            if (btnResume.consumeClick() && state == State::Paused)
-                state = State::Playing;
+            if (btnResume.consumeClick() && paused)
+                paused = false;
             if (btnRestart.consumeClick())
                 resetAll();
             if (btnBack.consumeClick())
                 ctx.requestedScene = SceneId::MainMenu;
+
+            // Attract mode loops on its own
+            if (autoplayer && !paused)
+            {
+                endScreenSeconds += dt;
+                if (endScreenSeconds >= AUTOPLAY_RESTART_DELAY)
+                    resetAll();
+            }
             return;
         }
 
-        // Aim cannon
-        cannon.pointAt(mpos.x, mpos.y);
-
-        // Fire cooldown
-        if (fireCooldown > 0.0f)
-            fireCooldown = std::max(0.0f, fireCooldown - dt);
-
-        // Fire (multi-shot, arcade feel)
-        const int cost = shotCost(currentShot);
-        if (firingHeld && fireCooldown <= 0.0f && static_cast<int>(projectiles.size()) < maxActive && used + cost <= budget)
+        if (replaying)
         {
-            fire(currentShot);
-            used += cost;
-            fireCooldown = fireCooldownSeconds(ctx.settings.difficulty);
+            // Recorded step size, not ours: the playback is exact whatever simulationHz is now
+            if (!replayFinished())
+                sim.step(replay.header.stepSeconds(), replay.rebornInput(replayTick++));
+            return;
         }
 
-        // Update projectiles
-        for (auto &p : projectiles)
-            p.update(dt);
-
-        // Remove lost/dead projectiles (also update miss penalty)
-        projectiles.erase(std::remove_if(projectiles.begin(), projectiles.end(),
-                                         [this](const Projectile &p)
-                                         {
-                                             if (p.isLost() || p.isDead())
-                                             {
-                                                 if (!p.hasHitSomething())
-                                                     combo = 0;
-                                                 return true;
-                                             }
-                                             return false;
-                                         }),
-                          projectiles.end());
-
-        // Bricks descend (pressure)
-        const float descend = brickDescendSpeed(ctx.settings.difficulty) * dt;
-        for (auto &b : bricks)
+        RebornInput step;
+        if (autoplayer)
         {
-            if (b.isDestroyed())
-                continue;
-            const sf::Vector2f pos = b.getPosition();
-            b.setPosition(pos.x, pos.y + descend);
+            step = autoplayer->think(sim, dt);
         }
-
-        // Danger line lose condition
-        for (const auto &b : bricks)
+        else
         {
-            if (b.isDestroyed())
-                continue;
-            const sf::Vector2f pos = b.getPosition();
-            const sf::Vector2f sz = b.getSize();
-            if (pos.y + sz.y >= dangerLineY)
-            {
-                state = State::Lose;
-                loseReason = LoseReason::DangerLine;
-                return;
-            }
-        }
+            step.aim = Render::fromSf(input.mouse());
+            step.fireHeld = input.isHeld(sf::Mouse::Left);
 
-        // Collisions projectile-bricks
-        for (auto &p : projectiles)
-        {
-            for (auto &b : bricks)
+            // Click timed by the mouse sampler: the shot leaves at that sub-step, at that aim
+            if (input.wasPressed(sf::Mouse::Left) && input.leftPressAt > 0.0f)
             {
-                if (b.isDestroyed())
-                    continue;
-                if (p.checkCollision(b))
-                {
-                    p.markHit();
-
-                    // Determine collision normal (for proper bounce and depenetration)
-                    sf::Vector2f n(0.0f, -1.0f);
-                    float pen = 0.0f;
-                    circleRectCollisionNormal(p, b, n, pen);
-
-                    // Damage & scoring
-                    b.takeDamage(1);
-                    score += 5;
-                    if (b.isDestroyed())
-                        score += b.getMaxHP() * 10;
-
-                    // Combo: reward accurate shots
-                    combo = std::min(combo + 1, 20);
-                    score += combo; // small ramp
-
-                    // Special shot behavior
-                    if (p.getShotType() == Projectile::ShotType::Explosive)
-                    {
-                        const float R = p.getExplosionRadius();
-                        const sf::Vector2f hitPos = p.getPosition();
-
-                        for (auto &bb : bricks)
-                        {
-                            if (bb.isDestroyed())
-                                continue;
-                            const sf::Vector2f bp = bb.getPosition();
-                            const sf::Vector2f bs = bb.getSize();
-                            const sf::Vector2f bc(bp.x + bs.x / 2.0f, bp.y + bs.y / 2.0f);
-                            const float dx = bc.x - hitPos.x;
-                            const float dy = bc.y - hitPos.y;
-                            if (dx * dx + dy * dy <= R * R)
-                            {
-                                const bool wasAlive = !bb.isDestroyed();
-                                bb.takeDamage(1);
-                                if (wasAlive && bb.isDestroyed())
-                                    score += bb.getMaxHP() * 8;
-                            }
-                        }
-
-                        // Explosive projectile disappears on hit
-                        p.kill();
-                        break;
-                    }
-
-                    if (p.getShotType() == Projectile::ShotType::Piercing && p.getPierceRemaining() > 0)
-                    {
-                        // Push out, keep going, consume one piercing hit
-                        const sf::Vector2f pos = p.getPosition();
-                        p.setPosition(pos.x + n.x * (pen + 0.5f), pos.y + n.y * (pen + 0.5f));
-                        p.consumePierceHit();
-                        break;
-                    }
-
-                    // Normal bounce
-                    {
-                        sf::Vector2f v = p.getVelocity();
-                        v = reflect(v, n);
-                        p.setVelocity(v);
-                        const sf::Vector2f pos = p.getPosition();
-                        p.setPosition(pos.x + n.x * (pen + 0.5f), pos.y + n.y * (pen + 0.5f));
-                    }
-
-                    break; // one collision per projectile per frame
-                }
+                step.fireAt = input.leftPressAt;
+                step.fireAim = Render::fromSf(sf::Vector2f(input.leftPressPosition));
             }
+            step.selectShot = shotSelectPending;
+            step.shot = pendingShot;
         }
+        shotSelectPending = false;
 
-        // Win condition
-        if (std::all_of(bricks.begin(), bricks.end(), [](const RebornGame::Brick &b)
-                        { return b.isDestroyed(); }))
-        {
-            state = State::Win;
-            return;
-        }
+        if (recording)
+            replay.record(step);
+        sim.step(dt, step);
 
-        // Lose condition: no budget remaining and nothing active
-        if (used >= budget && projectiles.empty())
-        {
-            state = State::Lose;
-            loseReason = LoseReason::OutOfAmmo;
-        }
+        if (sim.getState() != RebornSimulation::State::Playing || recordingFull())
+            saveRecording();
     }
 
-    void render(sf::RenderTarget &target) override
+    std::unique_ptr<SceneFrame> createFrame() const override
     {
-        sf::RectangleShape bg(sf::Vector2f(WINDOW_W, WINDOW_H));
-        bg.setFillColor(sf::Color(10, 10, 18));
-        target.draw(bg);
+        return std::make_unique<Frame>();
+    }
 
-        for (auto &b : bricks)
-            if (!b.isDestroyed())
-                b.draw(static_cast<sf::RenderWindow &>(target));
+    void capture(SceneFrame &frame) const override
+    {
+        TRACE_SCOPE("RebornGameScene::capture");
+
+        Frame &f = static_cast<Frame &>(frame);
+        f.bricks = sim.getBricks(); // reuses the frame's arrays
+        f.lastDescend = sim.getLastDescend();
+        f.projectiles.clear();
+        for (const auto &p : sim.getProjectiles())
+            f.projectiles.push_back(Render::ObjectSnapshot::of(p));
+        f.cannon = Render::ObjectSnapshot::of(sim.getCannon());
+        f.dangerLineY = sim.getDangerLineY();
+        f.lowestBrickBottom = sim.lowestBrickBottom();
+
+        f.state = sim.getState();
+        f.loseReason = sim.getLoseReason();
+        f.score = sim.getScore();
+        f.ammoLeft = sim.getBudget() - sim.getUsed();
+        f.budget = sim.getBudget();
+        f.maxActive = sim.getMaxActive();
+        f.shot = sim.getCurrentShot();
+        f.cooldown = sim.getFireCooldown() > 0.0f;
+        f.combo = sim.getCombo();
+        f.endless = sim.getMode() == RebornSimulation::Mode::Endless;
+        f.streamedRows = sim.getStreamedRows();
+        f.replaying = replaying;
+        f.replayTick = replayTick;
+        f.replaySize = replay.size();
+        f.autoplay = autoplayer != nullptr;
+        f.searchSeconds = autoplayer ? autoplayer->getLastSearchSeconds() : 0.0;
+        f.paused = paused;
+        f.frozen = paused || sim.getState() != RebornSimulation::State::Playing || replayFinished();
+
+        f.resume = btnResume.getLook();
+        f.restart = btnRestart.getLook();
+        f.back = btnBack.getLook();
+    }
 
-        for (auto &p : projectiles)
-            p.draw(static_cast<sf::RenderWindow &>(target));
+    void render(sf::RenderTarget &target, const SceneFrame &frame, float alpha) override
+    {
+        TRACE_SCOPE("RebornGameScene::render");
 
-        cannon.draw(static_cast<sf::RenderWindow &>(target));
+        const Frame &f = static_cast<const Frame &>(frame);
 
-        drawHud(target);
-        drawDangerLine(target);
+        // Frozen simulation: draw the current state, not a blend with the previous step
+        if (f.frozen)
+            alpha = 1.0f;
 
-        if (state == State::Paused)
+        target.clear(sf::Color(10, 10, 18));
+
+        // Bricks: cached layer, the descent only moves it (hit bricks are redrawn in the cache).
+        // The field moved down by lastDescend this step: draw it partway back
+        brickLayer.draw(target, f.bricks, -f.lastDescend * (1.0f - alpha));
+
+        // Projectiles, cannon and danger line in one draw call
+        batch.clear();
+        for (const auto &p : f.projectiles)
+            batch.addObject(p, alpha);
+
+        batch.addCannon(f.cannon);
+        addDangerLine(f);
+        batch.flush(target);
+
+        drawHud(target, f);
+        drawDangerBar(target, f);
+
+        if (f.paused)
         {
             drawOverlay(target, "PAUSED", "Resume / Restart / Back");
-            btnResume.render(target);
-            btnRestart.render(target);
-            btnBack.render(target);
+            btnResume.render(target, f.resume);
+            btnRestart.render(target, f.restart);
+            btnBack.render(target, f.back);
         }
-        else if (state == State::Win)
+        else if (f.state == RebornSimulation::State::Win)
         {
             drawOverlay(target, "VICTORY!", "Space: Restart");
-            btnRestart.render(target);
-            btnBack.render(target);
+            btnRestart.render(target, f.restart);
+            btnBack.render(target, f.back);
         }
-        else if (state == State::Lose)
+        else if (f.state == RebornSimulation::State::Lose)
         {
-            drawOverlay(target, "DEFEAT", (loseReason == LoseReason::DangerLine) ? "Bricks reached the danger line" : "Out of ammo");
-            btnRestart.render(target);
-            btnBack.render(target);
+            drawOverlay(target, "DEFEAT", (f.loseReason == RebornSimulation::LoseReason::DangerLine) ? "Bricks reached the danger line" : "Out of ammo");
+            btnRestart.render(target, f.restart);
+            btnBack.render(target, f.back);
         }
     }
 
 private:
-    enum class State
-    {
-        Playing,
-        Paused,
-        Win,
-        Lose,
-    };
+    // Declared before sim: a replay decides the difficulty and level it is built with
+    bool replaying = false;
+    RebornSimulation sim;
 
-    enum class LoseReason
-    {
-        OutOfAmmo,
-        DangerLine,
-    };
-
-    Cannon cannon;
-    std::vector<Projectile> projectiles;
-    std::vector<RebornGame::Brick> bricks;
+    Replay replay;
+    std::size_t replayTick = 0;
+    bool recording = false; // inputs not saved yet
 
-    int score = 0;
-    int budget = 50;
-    int used = 0;
-    int maxActive = 4;
-    float fireCooldown = 0.0f;
-    int combo = 0;
+    // Autoplay: the search forks the game on every core (the application's JobSystem)
+    std::unique_ptr<RebornAutoplayer> autoplayer;
+    float endScreenSeconds = 0.0f;
 
-    bool firingHeld = false;
-    State state = State::Playing;
-    LoseReason loseReason = LoseReason::OutOfAmmo;
-    Projectile::ShotType currentShot = Projectile::ShotType::Normal;
+    Render::BrickLayer brickLayer;
+    Render::ShapeBatch batch;
 
-    float dangerLineY = WINDOW_H - 150.0f;
+    bool paused = false;
+    bool shotSelectPending = false;
+    Projectile::ShotType pendingShot = Projectile::ShotType::Normal;
 
     Button btnResume;
     Button btnRestart;
     Button btnBack;
 
-    void resetLevel()
+    struct Frame : SceneFrame
     {
-        bricks.clear();
-        projectiles.clear();
-        score = 0;
-        used = 0;
-        combo = 0;
-        fireCooldown = 0.0f;
-        firingHeld = false;
-        state = State::Playing;
-        loseReason = LoseReason::OutOfAmmo;
-        currentShot = Projectile::ShotType::Normal;
-        maxActive = maxActiveShots(ctx.settings.difficulty);
-        dangerLineY = WINDOW_H - 150.0f;
-
-        const float brickW = 72.0f;
-        const float brickH = 28.0f;
-        const float spacing = 6.0f;
-        const float totalW = BRICK_COLS * brickW + (BRICK_COLS - 1) * spacing;
-        const float startX = (WINDOW_W - totalW) / 2.0f;
-        const float startY = 80.0f;
-
-        for (int r = 0; r < BRICK_ROWS; r++)
+        BrickField bricks;
+        float lastDescend = 0.0f;
+        std::vector<Render::ObjectSnapshot> projectiles; // keeps its capacity between steps
+        Render::ObjectSnapshot cannon;
+        float dangerLineY = 0.0f;
+        float lowestBrickBottom = 0.0f;
+
+        // HUD
+        RebornSimulation::State state = RebornSimulation::State::Playing;
+        RebornSimulation::LoseReason loseReason = RebornSimulation::LoseReason::OutOfAmmo;
+        int score = 0;
+        int ammoLeft = 0;
+        int budget = 0;
+        int maxActive = 0;
+        Projectile::ShotType shot = Projectile::ShotType::Normal;
+        bool cooldown = false;
+        int combo = 0;
+        bool endless = false;
+        int streamedRows = 0;
+        bool replaying = false;
+        std::size_t replayTick = 0;
+        std::size_t replaySize = 0;
+        bool autoplay = false;
+        double searchSeconds = 0.0;
+        bool paused = false;
+        bool frozen = false; // no step is running: draw without interpolation
+
+        Button::Look resume;
+        Button::Look restart;
+        Button::Look back;
+    };
+
+    void resetAll()
+    {
+        sim.resetAll();
+        paused = false;
+        shotSelectPending = false;
+        endScreenSeconds = 0.0f;
+
+        // Restart: replay from the start, or keep the abandoned game and record a new one
+        replayTick = 0;
+        if (!replaying)
         {
-            for (int c = 0; c < BRICK_COLS; c++)
-            {
-                const float x = startX + c * (brickW + spacing);
-                const float y = startY + r * (brickH + spacing);
+            saveRecording();
+            startRecording();
+        }
+    }
 
-                const int hp = brickHpForRow(ctx.settings.difficulty, r);
-                bricks.emplace_back(x, y, brickW, brickH, hp);
-            }
+    void setAutoplay(bool on)
+    {
+        if (!on)
+        {
+            autoplayer.reset();
+            return;
         }
+        autoplayer = std::make_unique<RebornAutoplayer>(ctx.jobs);
     }
 
-    void resetAll()
+    bool replayFinished() const
+    {
+        return replaying && replayTick >= replay.size();
+    }
+
+    void startRecording()
     {
-        budget = projectileBudget(ctx.settings.difficulty);
-        resetLevel();
+        recording = ctx.settings.recordReplays;
+        replay.clear();
+        replay.header.mode = ReplayMode::Reborn;
+        replay.header.difficulty = ctx.settings.difficulty;
+        replay.header.simulationHz = ctx.settings.simulationHz;
+        replay.header.seed = sim.getSeed();
+        replay.header.endless = sim.getMode() == RebornSimulation::Mode::Endless;
+        replay.header.level = Level(sim.getLevel());
     }
 
-    void fire(Projectile::ShotType type)
+    bool recordingFull() const
     {
-        const float angle = cannon.getDirectionRadians();
-        const sf::Vector2f pos = cannon.getPosition();
-        const float speed = projectileSpeed(ctx.settings.difficulty);
+        return recording && replay.size() >= static_cast<std::size_t>(MAX_RECORDED_SECONDS) * replay.header.simulationHz;
+    }
+
+    void saveRecording()
+    {
+        if (!recording)
+            return;
+        recording = false;
+        if (replay.empty())
+            return;
 
-        const float offset = 34.0f;
-        const float ox = offset * std::cos(angle);
-        const float oy = offset * std::sin(angle);
+        replay.result.known = true;
+        replay.result.score = sim.getScore();
+        replay.result.stateHash = sim.stateHash();
 
-        projectiles.emplace_back(pos.x + ox, pos.y + oy, angle, WINDOW_W, WINDOW_H, speed, type);
+        const std::string path = Replay::makeDefaultPath(ReplayMode::Reborn);
+        if (!replay.saveToFile(path))
+            std::cerr << "Cannot write replay " << path << "\n";
     }
 
-    void drawHud(sf::RenderTarget &target)
+    void selectShot(Projectile::ShotType type)
+    {
+        pendingShot = type;
+        shotSelectPending = true;
+    }
+
+    void drawHud(sf::RenderTarget &target, const Frame &f)
     {
         if (!ctx.assets.uiFontLoaded)
             return;
 
         std::ostringstream ss;
-        ss << "Score: " << score
-           << "    Ammo: " << (budget - used) << "/" << budget
-           << "    Active: " << projectiles.size() << "/" << maxActive
-           << "    Shot: " << shotName(currentShot)
-           << "    Cooldown: " << (fireCooldown > 0.0f ? "..." : "READY")
-           << "    Combo: x" << (combo > 0 ? combo : 0)
-           << "    (Hold LMB to fire, 1/2/3 switch)";
+        ss << "Score: " << f.score
+           << "    Ammo: " << f.ammoLeft << "/" << f.budget
+           << "    Active: " << f.projectiles.size() << "/" << f.maxActive
+           << "    Shot: " << shotName(f.shot)
+           << "    Cooldown: " << (f.cooldown ? "..." : "READY")
+           << "    Combo: x" << (f.combo > 0 ? f.combo : 0);
+        if (f.endless)
+            ss << "    Rows: " << f.streamedRows;
+        if (f.replaying)
+            ss << "    REPLAY " << f.replayTick << "/" << f.replaySize;
+        else if (f.autoplay)
+            ss << "    AUTOPLAY " << std::fixed << std::setprecision(1) << f.searchSeconds * 1000.0
+               << " ms/search (Tab: stop)";
+        else
+            ss << "    (Hold LMB to fire, 1/2/3 switch, Tab autoplay)";
         sf::Text t(ss.str(), ctx.assets.uiFont, 18);
         t.setFillColor(sf::Color(220, 220, 235));
         t.setPosition(12.0f, 10.0f);
         target.draw(t);
     }
 
-    void drawDangerLine(sf::RenderTarget &target)
+    void addDangerLine(const Frame &f)
     {
-        sf::RectangleShape line(sf::Vector2f(WINDOW_W, 2.0f));
-        line.setPosition(0.0f, dangerLineY);
-        line.setFillColor(sf::Color(255, 80, 80, 220));
-        target.draw(line);
+        const float dangerLineY = f.dangerLineY;
+
+        batch.addRect(0.0f, dangerLineY, WINDOW_W, 2.0f, sf::Color(255, 80, 80, 220));
+    }
+
+    void drawDangerBar(sf::RenderTarget &target, const Frame &f)
+    {
+        const float dangerLineY = f.dangerLineY;
 
         // progress bar (how close the lowest brick is)
-        float maxBottom = 0.0f;
-        for (const auto &b : bricks)
-        {
-            if (b.isDestroyed())
-                continue;
-            const sf::Vector2f pos = b.getPosition();
-            const sf::Vector2f sz = b.getSize();
-            maxBottom = std::max(maxBottom, pos.y + sz.y);
-        }
-        const float p = clampf(maxBottom / dangerLineY, 0.0f, 1.0f);
+        const float p = clampf(f.lowestBrickBottom / dangerLineY, 0.0f, 1.0f);
         sf::RectangleShape barBg(sf::Vector2f(160.0f, 10.0f));
         barBg.setPosition(WINDOW_W - 180.0f, 14.0f);
         barBg.setFillColor(sf::Color(0, 0, 0, 140));
@@ -633,5 +480,10 @@ private:
 
 std::unique_ptr<IScene> makeRebornGameScene(AppContext &ctx)
 {
-    return std::make_unique<RebornGameScene>(ctx);
+    return std::make_unique<RebornGameScene>(ctx, RebornSimulation::Mode::Standard);
+}
+
+std::unique_ptr<IScene> makeRebornEndlessScene(AppContext &ctx)
+{
+    return std::make_unique<RebornGameScene>(ctx, RebornSimulation::Mode::Endless);
 }
@@ -2,6 +2,7 @@
 #include "../ui/Button.hpp"
 
 #include <SFML/Graphics.hpp>
+#include <array>
 #include <memory>
 #include <string>
 
@@ -33,6 +34,22 @@ static Difficulty nextDifficulty(Difficulty d)
     }
 }
 
+// 60 -> 120 -> 144 -> uncapped (0) -> 60; a hand-edited rate goes back to 60
+static int nextFrameRate(int fps)
+{
+    switch (fps)
+    {
+    case 60:
+        return 120;
+    case 120:
+        return 144;
+    case 144:
+        return 0;
+    default:
+        return 60;
+    }
+}
+
 static float clamp01(float v)
 {
     if (v < 0.0f)
@@ -64,22 +81,32 @@ public:
             labelVolume.setFont(*font);
             labelVolume.setCharacterSize(26);
             labelVolume.setFillColor(sf::Color(220, 220, 235));
-            labelVolume.setPosition(170.0f, 200.0f);
+            labelVolume.setPosition(170.0f, 190.0f);
 
             labelDifficulty.setFont(*font);
             labelDifficulty.setCharacterSize(26);
             labelDifficulty.setFillColor(sf::Color(220, 220, 235));
-            labelDifficulty.setPosition(170.0f, 290.0f);
-        }
+            labelDifficulty.setPosition(170.0f, 260.0f);
+
+            labelFrameRate.setFont(*font);
+            labelFrameRate.setCharacterSize(26);
+            labelFrameRate.setFillColor(sf::Color(220, 220, 235));
+            labelFrameRate.setPosition(170.0f, 330.0f);
 
-        btnVolMinus = Button(font, "-", {520.0f, 195.0f}, {60.0f, 48.0f});
-        btnVolPlus = Button(font, "+", {590.0f, 195.0f}, {60.0f, 48.0f});
+            labelVsync.setFont(*font);
+            labelVsync.setCharacterSize(26);
+            labelVsync.setFillColor(sf::Color(220, 220, 235));
+            labelVsync.setPosition(170.0f, 400.0f);
+        }
 
-        btnDiffCycle = Button(font, "Change", {520.0f, 285.0f}, {130.0f, 48.0f});
+        btnVolMinus = Button(font, "-", {520.0f, 185.0f}, {60.0f, 48.0f});
+        btnVolPlus = Button(font, "+", {590.0f, 185.0f}, {60.0f, 48.0f});
 
-        btnBack = Button(font, "Back", {170.0f, 470.0f}, {220.0f, 60.0f});
+        btnDiffCycle = Button(font, "Change", {520.0f, 255.0f}, {130.0f, 48.0f});
+        btnFrameRate = Button(font, "Change", {520.0f, 325.0f}, {130.0f, 48.0f});
+        btnVsync = Button(font, "Toggle", {520.0f, 395.0f}, {130.0f, 48.0f});
 
-        syncLabels();
+        btnBack = Button(font, "Back", {170.0f, 480.0f}, {220.0f, 60.0f});
     }
 
     void handleEvent(const sf::Event &event) override
@@ -95,46 +122,47 @@ public:
         else if (event.key.code == sf::Keyboard::Left)
         {
             ctx.settings.masterVolume = clamp01(ctx.settings.masterVolume - 0.05f);
-            syncLabels();
         }
         else if (event.key.code == sf::Keyboard::Right)
         {
             ctx.settings.masterVolume = clamp01(ctx.settings.masterVolume + 0.05f);
-            syncLabels();
         }
         else if (event.key.code == sf::Keyboard::Enter || event.key.code == sf::Keyboard::Space)
         {
             // Shortcut: cycle difficulty
             ctx.settings.difficulty = nextDifficulty(ctx.settings.difficulty);
-            syncLabels();
         }
     }
 
-    void update(float) override
+    void update(float, const InputSnapshot &input) override
     {
-        const sf::Vector2i mp = sf::Mouse::getPosition(ctx.window);
-        const sf::Vector2f mpos(static_cast<float>(mp.x), static_cast<float>(mp.y));
-        const bool mouseDown = sf::Mouse::isButtonPressed(sf::Mouse::Left);
-
-        btnVolMinus.update(mpos, mouseDown);
-        btnVolPlus.update(mpos, mouseDown);
-        btnDiffCycle.update(mpos, mouseDown);
-        btnBack.update(mpos, mouseDown);
+        btnVolMinus.update(input);
+        btnVolPlus.update(input);
+        btnDiffCycle.update(input);
+        btnFrameRate.update(input);
+        btnVsync.update(input);
+        btnBack.update(input);
 
         if (btnVolMinus.consumeClick())
         {
             ctx.settings.masterVolume = clamp01(ctx.settings.masterVolume - 0.05f);
-            syncLabels();
         }
         else if (btnVolPlus.consumeClick())
         {
             ctx.settings.masterVolume = clamp01(ctx.settings.masterVolume + 0.05f);
-            syncLabels();
         }
         else if (btnDiffCycle.consumeClick())
         {
             ctx.settings.difficulty = nextDifficulty(ctx.settings.difficulty);
-            syncLabels();
+        }
+        else if (btnFrameRate.consumeClick())
+        {
+            // App applies it on its next frame
+            ctx.settings.frameRate = nextFrameRate(ctx.settings.frameRate);
+        }
+        else if (btnVsync.consumeClick())
+        {
+            ctx.settings.vsync = !ctx.settings.vsync;
         }
         else if (btnBack.consumeClick())
         {
@@ -143,8 +171,27 @@ public:
         }
     }
 
-    void render(sf::RenderTarget &target) override
+    std::unique_ptr<SceneFrame> createFrame() const override
+    {
+        return std::make_unique<Frame>();
+    }
+
+    void capture(SceneFrame &frame) const override
+    {
+        Frame &f = static_cast<Frame &>(frame);
+        f.masterVolume = ctx.settings.masterVolume;
+        f.difficulty = ctx.settings.difficulty;
+        f.frameRate = ctx.settings.frameRate;
+        f.vsync = ctx.settings.vsync;
+        for (int i = 0; i < BUTTON_COUNT; i++)
+            f.looks[i] = buttons[i]->getLook();
+    }
+
+    void render(sf::RenderTarget &target, const SceneFrame &frame, float) override
     {
+        const Frame &f = static_cast<const Frame &>(frame);
+        syncLabels(f);
+
         sf::RectangleShape top(sf::Vector2f(800.0f, 3.0f));
         top.setFillColor(sf::Color(255, 200, 0));
         target.draw(top);
@@ -154,6 +201,8 @@ public:
             target.draw(title);
             target.draw(labelVolume);
             target.draw(labelDifficulty);
+            target.draw(labelFrameRate);
+            target.draw(labelVsync);
 
             sf::Text hint("Left/Right: volume, Enter: cycle difficulty, Esc: back", ctx.assets.uiFont, 16);
             hint.setFillColor(sf::Color(150, 150, 170));
@@ -163,30 +212,47 @@ public:
             target.draw(hint);
         }
 
-        btnVolMinus.render(target);
-        btnVolPlus.render(target);
-        btnDiffCycle.render(target);
-        btnBack.render(target);
+        for (int i = 0; i < BUTTON_COUNT; i++)
+            buttons[i]->render(target, f.looks[i]);
     }
 
 private:
     sf::Text title;
     sf::Text labelVolume;
     sf::Text labelDifficulty;
+    sf::Text labelFrameRate;
+    sf::Text labelVsync;
 
     Button btnVolMinus;
     Button btnVolPlus;
     Button btnDiffCycle;
+    Button btnFrameRate;
+    Button btnVsync;
     Button btnBack;
 
-    void syncLabels()
+    static constexpr int BUTTON_COUNT = 6;
+    const std::array<Button *, BUTTON_COUNT> buttons{&btnVolMinus, &btnVolPlus, &btnDiffCycle, &btnFrameRate, &btnVsync, &btnBack};
+
+    // Settings are edited on the simulation side: the labels are set from the frame
+    struct Frame : SceneFrame
+    {
+        float masterVolume = 0.0f;
+        Difficulty difficulty = Difficulty::Normal;
+        int frameRate = 0;
+        bool vsync = false;
+        std::array<Button::Look, BUTTON_COUNT> looks;
+    };
+
+    void syncLabels(const Frame &f)
     {
         if (!ctx.assets.uiFontLoaded)
             return;
 
-        const int volPct = static_cast<int>(ctx.settings.masterVolume * 100.0f + 0.5f);
+        const int volPct = static_cast<int>(f.masterVolume * 100.0f + 0.5f);
         labelVolume.setString("Master Volume: " + std::to_string(volPct) + "%");
-        labelDifficulty.setString(std::string("Difficulty: ") + difficultyLabel(ctx.settings.difficulty));
+        labelDifficulty.setString(std::string("Difficulty: ") + difficultyLabel(f.difficulty));
+        labelFrameRate.setString("Frame Rate: " + (f.frameRate > 0 ? std::to_string(f.frameRate) + " fps" : std::string("Uncapped")));
+        labelVsync.setString(std::string("VSync: ") + (f.vsync ? "On" : "Off"));
     }
 };
 
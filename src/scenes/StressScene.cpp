@@ -0,0 +1,272 @@
+#include "../app/App.hpp"
+
+#include "../core/Trace.hpp"
+#include "../render/BrickLayer.hpp"
+#include "../render/ObjectRenderer.hpp"
+#include "../stress/StressSimulation.hpp"
+
+#include <SFML/Graphics.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+    constexpr float WINDOW_W = StressSimulation::FIELD_W;
+    constexpr float WINDOW_H = StressSimulation::FIELD_H;
+
+    constexpr float STATS_WINDOW = 0.5f; // seconds between readout refreshes
+    constexpr std::size_t CAPTURE_GRAIN = 1024; // object snapshots per job
+
+    int scaleUp(int v) { return std::max(1, v * 2); }
+    int scaleDown(int v) { return v / 2; }
+
+} // namespace
+
+/**
+ * Synthetic load: thousands of bricks, projectiles and balls on the real collision path.
+ * Counts come from the command line (--bricks/--projectiles/--balls) and can be
+ * doubled/halved live; the readout shows update/render cost and entity counts.
+ * Contact search and frame capture are split across cores by ctx.jobs (J toggles it).
+ */
+class StressScene final : public IScene
+{
+public:
+    explicit StressScene(AppContext &ctx)
+        : IScene(ctx),
+          sim(ctx.launch.stress)
+    {
+        sim.setJobs(&ctx.jobs);
+    }
+
+    void handleEvent(const sf::Event &event) override
+    {
+        TRACE_SCOPE("StressScene::handleEvent");
+
+        if (event.type != sf::Event::KeyPressed)
+            return;
+
+        StressConfig config = sim.getConfig();
+        switch (event.key.code)
+        {
+        case sf::Keyboard::Escape:
+            ctx.requestedScene = SceneId::MainMenu;
+            return;
+        case sf::Keyboard::Space:
+            paused = !paused;
+            return;
+        case sf::Keyboard::J:
+            useJobs = !useJobs;
+            sim.setJobs(useJobs ? &ctx.jobs : nullptr);
+            return;
+        case sf::Keyboard::R:
+            break;
+        case sf::Keyboard::Q:
+            config.bricks = scaleUp(config.bricks);
+            break;
+        case sf::Keyboard::A:
+            config.bricks = scaleDown(config.bricks);
+            break;
+        case sf::Keyboard::W:
+            config.projectiles = scaleUp(config.projectiles);
+            break;
+        case sf::Keyboard::S:
+            config.projectiles = scaleDown(config.projectiles);
+            break;
+        case sf::Keyboard::E:
+            config.balls = scaleUp(config.balls);
+            break;
+        case sf::Keyboard::D:
+            config.balls = scaleDown(config.balls);
+            break;
+        default:
+            return;
+        }
+
+        // Regenerate with the new counts; keep them for the next visit
+        config.clamp();
+        ctx.launch.stress = config;
+        sim.reset(config);
+    }
+
+    void update(float dt, const InputSnapshot &) override
+    {
+        TRACE_SCOPE("StressScene::update");
+
+        if (paused)
+            return;
+
+        sf::Clock clock;
+        sim.step(dt);
+        updateSeconds += clock.getElapsedTime().asSeconds();
+        updateSteps++;
+        refreshUpdateStats();
+    }
+
+    std::unique_ptr<SceneFrame> createFrame() const override
+    {
+        return std::make_unique<Frame>();
+    }
+
+    void capture(SceneFrame &frame) const override
+    {
+        TRACE_SCOPE("StressScene::capture");
+
+        Frame &f = static_cast<Frame &>(frame);
+        f.bricks = sim.getBricks(); // reuses the frame's arrays
+
+        const ProjectilePool &projectiles = sim.getProjectiles();
+        const std::vector<int> &live = projectiles.liveSlots();
+        const std::vector<Ball> &balls = sim.getBalls();
+        f.objects.resize(live.size() + balls.size());
+
+        auto snapshot = [&](std::size_t begin, std::size_t end, unsigned)
+        {
+            for (std::size_t i = begin; i < end; i++)
+                f.objects[i] = i < live.size() ? Render::ObjectSnapshot::of(projectiles[live[i]])
+                                               : Render::ObjectSnapshot::of(balls[i - live.size()]);
+        };
+        if (useJobs)
+            ctx.jobs.parallelFor(f.objects.size(), CAPTURE_GRAIN, snapshot);
+        else
+            snapshot(0, f.objects.size(), 0);
+
+        f.projectiles = sim.getProjectiles().size();
+        f.balls = sim.getBalls().size();
+        f.totalHits = sim.getTotalHits();
+        f.regenerations = sim.getFieldRegenerations();
+        f.paused = paused;
+        f.updateMs = updateMs;
+        f.stepsPerSecond = stepsPerSecond;
+        f.threads = useJobs ? ctx.jobs.getWorkerCount() + 1 : 1;
+    }
+
+    void render(sf::RenderTarget &target, const SceneFrame &frame, float alpha) override
+    {
+        TRACE_SCOPE("StressScene::render");
+
+        const Frame &f = static_cast<const Frame &>(frame);
+        sf::Clock clock;
+
+        if (f.paused)
+            alpha = 1.0f;
+
+        target.clear(sf::Color(10, 10, 18));
+        brickLayer.draw(target, f.bricks);
+
+        batch.clear();
+        for (const auto &o : f.objects)
+            batch.addObject(o, alpha);
+        batch.flush(target);
+
+        renderSeconds += clock.getElapsedTime().asSeconds();
+        frames++;
+        refreshRenderStats(f);
+
+        drawReadout(target, f);
+    }
+
+private:
+    StressSimulation sim;
+    Render::BrickLayer brickLayer;
+    Render::ShapeBatch batch;
+
+    bool paused = false;
+    bool useJobs = true; // J
+
+    struct Frame : SceneFrame
+    {
+        BrickField bricks;
+        std::vector<Render::ObjectSnapshot> objects; // projectiles then balls
+        std::size_t projectiles = 0;
+        std::size_t balls = 0;
+        long long totalHits = 0;
+        int regenerations = 0;
+        bool paused = false;
+        double updateMs = 0.0;
+        int stepsPerSecond = 0;
+        unsigned threads = 1;
+    };
+
+    // Simulation side, accumulated over the current stats window
+    sf::Clock updateClock;
+    double updateSeconds = 0.0;
+    int updateSteps = 0;
+    double updateMs = 0.0; // last published window
+    int stepsPerSecond = 0;
+
+    // Render side
+    sf::Clock renderClock;
+    double renderSeconds = 0.0;
+    int frames = 0;
+
+    // Last published window
+    std::string readout = "measuring...";
+
+    void refreshUpdateStats()
+    {
+        const float elapsed = updateClock.getElapsedTime().asSeconds();
+        if (elapsed < STATS_WINDOW)
+            return;
+
+        updateMs = 1000.0 * updateSeconds / updateSteps;
+        stepsPerSecond = static_cast<int>(updateSteps / elapsed);
+
+        updateClock.restart();
+        updateSeconds = 0.0;
+        updateSteps = 0;
+    }
+
+    void refreshRenderStats(const Frame &f)
+    {
+        const float elapsed = renderClock.getElapsedTime().asSeconds();
+        if (elapsed < STATS_WINDOW)
+            return;
+
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision(3)
+           << "update " << f.updateMs << " ms/step"
+           << " (" << f.stepsPerSecond << " steps/s)"
+           << "   render " << (frames > 0 ? 1000.0 * renderSeconds / frames : 0.0) << " ms"
+           << "   " << static_cast<int>(frames / elapsed) << " fps";
+        readout = ss.str();
+
+        renderClock.restart();
+        renderSeconds = 0.0;
+        frames = 0;
+    }
+
+    void drawReadout(sf::RenderTarget &target, const Frame &f)
+    {
+        if (!ctx.assets.uiFontLoaded)
+            return;
+
+        std::ostringstream ss;
+        ss << readout << (f.paused ? "   [PAUSED]" : "") << "\n"
+           << "bricks " << f.bricks.getAliveCount() << "/" << f.bricks.size()
+           << "   projectiles " << f.projectiles
+           << "   balls " << f.balls
+           << "   vertices " << batch.getVertexCount()
+           << "   hits " << f.totalHits
+           << "   regen " << f.regenerations
+           << "   threads " << f.threads << "\n"
+           << "Q/A bricks x2 /2   W/S projectiles   E/D balls   R regenerate   J jobs   Space pause   Esc menu";
+
+        sf::RectangleShape bg(sf::Vector2f(WINDOW_W, 66.0f));
+        bg.setFillColor(sf::Color(0, 0, 0, 170));
+        target.draw(bg);
+
+        sf::Text t(ss.str(), ctx.assets.uiFont, 15);
+        t.setFillColor(sf::Color(220, 220, 235));
+        t.setPosition(8.0f, 4.0f);
+        target.draw(t);
+    }
+};
+
+std::unique_ptr<IScene> makeStressScene(AppContext &ctx)
+{
+    return std::make_unique<StressScene>(ctx);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <algorithm>
+
+/**
+ * @brief Nombre d'entités du test de charge
+ */
+struct StressConfig
+{
+    int bricks = 20000;
+    int projectiles = 1000;
+    int balls = 500;
+
+    static constexpr int MAX_BRICKS = 1000000;
+    static constexpr int MAX_PROJECTILES = 100000;
+    static constexpr int MAX_BALLS = 100000;
+
+    /**
+     * @brief Ramène chaque compteur dans [0, MAX_*]
+     */
+    void clamp()
+    {
+        bricks = std::max(0, std::min(bricks, MAX_BRICKS));
+        projectiles = std::max(0, std::min(projectiles, MAX_PROJECTILES));
+        balls = std::max(0, std::min(balls, MAX_BALLS));
+    }
+};
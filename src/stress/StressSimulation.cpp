@@ -0,0 +1,314 @@
+#include "StressSimulation.hpp"
+
+#include "../core/Collision.hpp"
+#include "../core/JobSystem.hpp"
+#include "../core/Trace.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // Bricks fill the upper part of the field, objects spawn near the bottom
+    constexpr float FIELD_TOP = 70.0f; // below the stress scene readout
+    constexpr float FIELD_BRICK_H = 330.0f;
+    constexpr float BRICK_ASPECT = 2.5f; // width / height of a brick cell
+
+    constexpr float PROJECTILE_SPEED = 500.0f;
+    constexpr float BALL_SPEED = 300.0f;
+    constexpr float BALL_RADIUS = 5.0f;
+
+    constexpr float CONTACT_SKIN = 0.01f;
+    constexpr float REGENERATE_BELOW = 0.05f; // rebuild the field under 5% live bricks
+
+    // Parallel contact search: below this many objects a step is faster on one thread
+    constexpr std::size_t PARALLEL_MIN_OBJECTS = 512;
+    constexpr std::size_t PARALLEL_GRAIN = 128; // objects per job
+
+    constexpr float PI = 3.14159265358979323846f;
+
+    // Box covering a circular object over its motion during dt (broadphase query)
+    AABB sweptBox(const GameObject &obj, float dt)
+    {
+        const Vec2 p = obj.getPosition();
+        const Vec2 motion = obj.getVelocity() * dt;
+        const float r = obj.getRadius();
+
+        const AABB from{p.x - r, p.y - r, p.x + r, p.y + r};
+        const AABB to{from.left + motion.x, from.top + motion.y, from.right + motion.x, from.bottom + motion.y};
+        return SpatialGrid::sweep(from, to);
+    }
+
+    Color brickColor(int hp)
+    {
+        const std::uint8_t shade = static_cast<std::uint8_t>(90 + 55 * std::min(hp, 3));
+        return Color(shade, static_cast<std::uint8_t>(255 - shade / 2), 80);
+    }
+} // namespace
+
+StressSimulation::StressSimulation(const StressConfig &config, std::uint32_t seed)
+    : rng(seed), scratch(1)
+{
+    reset(config);
+}
+
+void StressSimulation::setJobs(JobSystem *jobSystem)
+{
+    jobs = jobSystem;
+    scratch.resize(jobs ? jobs->maxThreads() : 1);
+}
+
+void StressSimulation::reset(const StressConfig &newConfig)
+{
+    config = newConfig;
+    config.clamp();
+
+    buildField();
+
+    projectiles.setCapacity(config.projectiles);
+    for (int i = 0; i < config.projectiles; i++)
+        spawnProjectile();
+
+    balls.clear();
+    balls.reserve(config.balls);
+    for (int i = 0; i < config.balls; i++)
+        spawnBall();
+
+    totalHits = 0;
+    regenerations = 0;
+}
+
+void StressSimulation::buildField()
+{
+    bricks.clear();
+    const int n = config.bricks;
+    if (n == 0)
+    {
+        brickGrid.rebuild(bricks.boxes());
+        return;
+    }
+
+    // Cell size so that n cells of the chosen aspect cover the brick area
+    const float cellArea = FIELD_W * FIELD_BRICK_H / static_cast<float>(n);
+    const float cellH0 = std::sqrt(cellArea / BRICK_ASPECT);
+    const int cols = std::max(1, static_cast<int>(FIELD_W / (cellH0 * BRICK_ASPECT)));
+    const int rows = (n + cols - 1) / cols;
+    const float cellW = FIELD_W / static_cast<float>(cols);
+    const float cellH = FIELD_BRICK_H / static_cast<float>(rows);
+
+    std::uniform_int_distribution<int> hp(1, 3);
+    bricks.reserve(n);
+    for (int i = 0; i < n; i++)
+    {
+        const int r = i / cols;
+        const int c = i % cols;
+        const int hitPoints = hp(rng);
+        bricks.add(c * cellW + cellW * 0.05f, FIELD_TOP + r * cellH + cellH * 0.075f,
+                   cellW * 0.9f, cellH * 0.85f, hitPoints, brickColor(hitPoints));
+    }
+
+    // Grid cells match the brick pitch, as in the real levels
+    brickGrid = SpatialGrid(cellW, cellH);
+    brickGrid.rebuild(bricks.boxes());
+}
+
+void StressSimulation::spawnProjectile()
+{
+    std::uniform_real_distribution<float> x(20.0f, FIELD_W - 20.0f);
+    std::uniform_real_distribution<float> angle(-150.0f, -30.0f); // upwards
+
+    projectiles.spawn(x(rng), FIELD_H - 20.0f, angle(rng) * PI / 180.0f, FIELD_W, FIELD_H, PROJECTILE_SPEED);
+}
+
+void StressSimulation::spawnBall()
+{
+    std::uniform_real_distribution<float> x(BALL_RADIUS, FIELD_W - BALL_RADIUS);
+    std::uniform_real_distribution<float> y(FIELD_TOP + FIELD_BRICK_H + 20.0f, FIELD_H - BALL_RADIUS);
+    std::uniform_real_distribution<float> angle(0.0f, 2.0f * PI);
+
+    balls.emplace_back(x(rng), y(rng), BALL_RADIUS, FIELD_W, FIELD_H, BALL_SPEED);
+    const float a = angle(rng);
+    balls.back().setVelocity(BALL_SPEED * std::cos(a), BALL_SPEED * std::sin(a));
+}
+
+void StressSimulation::step(float dt)
+{
+    TRACE_SCOPE("StressSimulation::step");
+
+    for (const int slot : projectiles.liveSlots())
+        projectiles[slot].savePreviousPosition();
+    for (auto &b : balls)
+        b.savePreviousPosition();
+
+    if (jobs && jobs->getWorkerCount() > 0 && projectiles.size() + balls.size() >= PARALLEL_MIN_OBJECTS)
+        stepParallel(dt);
+    else
+    {
+        {
+            TRACE_SCOPE("StressSimulation::projectiles");
+            for (const int slot : projectiles.liveSlots())
+                moveAgainstBricks(projectiles[slot], dt);
+        }
+
+        {
+            TRACE_SCOPE("StressSimulation::balls");
+            for (auto &b : balls)
+            {
+                moveAgainstBricks(b, dt);
+                bounceOffBottom(b);
+            }
+        }
+    }
+
+    // Relaunch lost projectiles from the bottom (recycled pool slots, no allocation)
+    const std::size_t before = projectiles.size();
+    projectiles.releaseIf([](const Projectile &p)
+                          { return p.isLost(); });
+    for (std::size_t i = projectiles.size(); i < before; i++)
+        spawnProjectile();
+
+    if (bricks.size() > 0 && bricks.getAliveCount() < static_cast<int>(REGENERATE_BELOW * bricks.size()))
+    {
+        TRACE_SCOPE("StressSimulation::buildField");
+        buildField();
+        regenerations++;
+    }
+}
+
+void StressSimulation::stepParallel(float dt)
+{
+    const std::vector<int> &live = projectiles.liveSlots();
+    const std::size_t projectileCount = live.size();
+    contacts.resize(projectileCount + balls.size());
+
+    {
+        // Read-only against the bricks as they are at the start of the step
+        TRACE_SCOPE("StressSimulation::findContacts");
+        jobs->parallelFor(contacts.size(), PARALLEL_GRAIN, [&](std::size_t begin, std::size_t end, unsigned thread)
+                          {
+                              Scratch &buffers = scratch[thread];
+                              for (std::size_t i = begin; i < end; i++)
+                              {
+                                  const GameObject &obj = i < projectileCount ? static_cast<const GameObject &>(projectiles[live[i]])
+                                                                              : balls[i - projectileCount];
+                                  brickGrid.queryConcurrent(sweptBox(obj, dt), buffers.nearby);
+                                  contacts[i] = findContact(obj, dt, buffers.nearby, buffers);
+                              } });
+    }
+
+    // Applied in the serial order. A contact stays valid while its brick is alive: the
+    // bricks destroyed earlier in the step were not the first hit, so removing them does
+    // not change it. Otherwise search again, as the serial step would have.
+    TRACE_SCOPE("StressSimulation::applyContacts");
+    for (std::size_t i = 0; i < contacts.size(); i++)
+    {
+        const Contact &contact = contacts[i];
+        GameObject &obj = i < projectileCount ? static_cast<GameObject &>(projectiles[live[i]])
+                                              : balls[i - projectileCount];
+        if (contact.brick >= 0 && !bricks.alive[contact.brick])
+            moveAgainstBricks(obj, dt);
+        else
+            applyContact(obj, dt, contact);
+
+        if (i >= projectileCount)
+            bounceOffBottom(balls[i - projectileCount]);
+    }
+}
+
+void StressSimulation::bounceOffBottom(Ball &ball) const
+{
+    // Nothing is lost here: bounce on the bottom edge too
+    if (!ball.isLost())
+        return;
+
+    const Vec2 v = ball.getVelocity();
+    ball.setPosition(ball.getPosition().x, FIELD_H - ball.getRadius());
+    ball.setVelocity(v.x, -std::abs(v.y));
+}
+
+void StressSimulation::moveAgainstBricks(GameObject &obj, float dt)
+{
+    applyContact(obj, dt, findContact(obj, dt, brickGrid.query(sweptBox(obj, dt)), scratch[0]));
+}
+
+StressSimulation::Contact StressSimulation::findContact(const GameObject &obj, float dt, const std::vector<int> &nearby,
+                                                        Scratch &buffers) const
+{
+    const Vec2 start = obj.getPosition();
+    const Vec2 motion = obj.getVelocity() * dt;
+    const float r = obj.getRadius();
+
+    Collision::CircleRectBatch &narrowphase = buffers.narrowphase;
+    std::vector<int> &candidates = buffers.candidates;
+    narrowphase.clear();
+    candidates.clear();
+    for (const int i : nearby)
+    {
+        if (!bricks.alive[i])
+            continue;
+        narrowphase.add(bricks.x[i], bricks.y[i], bricks.w[i], bricks.h[i]);
+        candidates.push_back(i);
+    }
+
+    Contact contact;
+    if (narrowphase.run(start, r) > 0)
+    {
+        // Already overlapping (field regenerated on top of it)
+        for (std::size_t k = 0; k < candidates.size(); k++)
+        {
+            if (!narrowphase.hit[k])
+                continue;
+            contact.brick = candidates[k];
+            contact.overlapping = true;
+            contact.depth = narrowphase.pen[k];
+            contact.normal = Vec2(narrowphase.nx[k], narrowphase.ny[k]);
+            break;
+        }
+        return contact;
+    }
+
+    for (const int i : candidates)
+    {
+        float t = 0.0f;
+        Vec2 n;
+        if (Collision::sweepCircleAABB(start, motion, r, bricks.getAABB(i), t, n) && (contact.brick < 0 || t < contact.t))
+        {
+            contact.brick = i;
+            contact.t = t;
+            contact.normal = n;
+        }
+    }
+    return contact;
+}
+
+void StressSimulation::applyContact(GameObject &obj, float dt, const Contact &contact)
+{
+    if (contact.brick < 0)
+    {
+        obj.update(dt);
+        return;
+    }
+
+    const Vec2 start = obj.getPosition();
+    const Vec2 n = contact.normal;
+
+    if (contact.overlapping)
+    {
+        // Push out, bounce, no damage
+        obj.setPosition(start + n * (contact.depth + CONTACT_SKIN));
+        if (obj.getVelocity().x * n.x + obj.getVelocity().y * n.y < 0.0f)
+            obj.setVelocity(Collision::reflect(obj.getVelocity(), n));
+        obj.update(dt);
+        return;
+    }
+
+    // Advance to the contact, bounce, then finish the step (walls handled by update)
+    const Vec2 motion = obj.getVelocity() * dt;
+    obj.setPosition(start + motion * contact.t + n * CONTACT_SKIN);
+    obj.setVelocity(Collision::reflect(obj.getVelocity(), n));
+    if (!bricks.damage(contact.brick, 1))
+        bricks.color[contact.brick] = brickColor(bricks.hp[contact.brick]);
+    totalHits++;
+
+    obj.update((1.0f - contact.t) * dt);
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../core/BrickField.hpp"
+#include "../core/CollisionBatch.hpp"
+#include "../core/SpatialGrid.hpp"
+#include "../core/Vec2.hpp"
+#include "../game/Ball.hpp"
+#include "../game_reborn/ProjectilePool.hpp"
+#include "StressConfig.hpp"
+
+class JobSystem;
+
+/**
+ * @brief Simulation synthétique de charge (sans SFML)
+ *
+ * Un très grand champ de briques (taille de brique adaptée au nombre demandé),
+ * des milliers de Projectile (ProjectilePool) et de Ball qui rebondissent sur les
+ * murs et les briques, via la même chaîne de collision que les vrais modes :
+ * SpatialGrid, narrowphase SIMD puis balayage (TOI).
+ *
+ * Rien ne se perd : un projectile sorti par le bas est relancé depuis le bas,
+ * une balle rebondit sur le bas, et le champ est régénéré quand il est presque vide.
+ *
+ * Avec un JobSystem (setJobs), la recherche des contacts se répartit entre les cœurs
+ * (lecture seule, contre les briques du début du pas), puis les contacts sont
+ * appliqués dans l'ordre : le résultat est identique à celui d'un seul thread.
+ */
+class StressSimulation
+{
+public:
+    static constexpr float FIELD_W = 800.0f;
+    static constexpr float FIELD_H = 600.0f;
+
+    explicit StressSimulation(const StressConfig &config, std::uint32_t seed = 1);
+
+    /**
+     * @brief Regénère tout (briques, projectiles, balles) avec une nouvelle configuration
+     */
+    void reset(const StressConfig &config);
+
+    /**
+     * @brief Avance la simulation d'un pas fixe
+     */
+    void step(float dt);
+
+    /**
+     * @brief Répartit la détection des contacts de step() sur jobs (nullptr : un seul thread)
+     *
+     * jobs doit survivre à la simulation, ou être retiré avant sa destruction.
+     */
+    void setJobs(JobSystem *jobs);
+
+    const StressConfig &getConfig() const { return config; }
+    const BrickField &getBricks() const { return bricks; }
+    const ProjectilePool &getProjectiles() const { return projectiles; }
+    const std::vector<Ball> &getBalls() const { return balls; }
+
+    long long getTotalHits() const { return totalHits; }
+    int getFieldRegenerations() const { return regenerations; }
+
+private:
+    StressConfig config;
+    std::mt19937 rng;
+
+    BrickField bricks;
+    SpatialGrid brickGrid;
+    ProjectilePool projectiles;
+    std::vector<Ball> balls;
+
+    // First brick touched by an object during a step, found without modifying anything
+    struct Contact
+    {
+        int brick = -1;           // -1: free flight
+        bool overlapping = false; // already inside the brick at the start (push out, no damage)
+        float t = 1.0f;           // sweep: fraction of the motion before the contact
+        float depth = 0.0f;       // overlap: penetration
+        Vec2 normal;
+    };
+
+    struct Scratch
+    {
+        Collision::CircleRectBatch narrowphase;
+        std::vector<int> candidates;
+        std::vector<int> nearby; // broadphase result
+    };
+
+    JobSystem *jobs = nullptr;
+    std::vector<Scratch> scratch; // one per job thread (just one without jobs)
+    std::vector<Contact> contacts; // parallel step: one per live projectile, then per ball
+
+    long long totalHits = 0;
+    int regenerations = 0;
+
+    void buildField();
+    void spawnProjectile();
+    void spawnBall();
+
+    /**
+     * @brief Déplace un objet circulaire sur dt en rebondissant sur la première brique touchée
+     *
+     * Un seul contact par pas : suffisant pour mesurer la charge, pas pour la précision du jeu.
+     */
+    void moveAgainstBricks(GameObject &obj, float dt);
+
+    // nearby: broadphase candidates (sorted), read-only on the simulation
+    Contact findContact(const GameObject &obj, float dt, const std::vector<int> &nearby, Scratch &buffers) const;
+    void applyContact(GameObject &obj, float dt, const Contact &contact);
+    void bounceOffBottom(Ball &ball) const;
+    void stepParallel(float dt);
+};
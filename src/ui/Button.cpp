@@ -10,6 +10,7 @@ Button::Button(const sf::Font *font,
     box.setSize(size);
     box.setOutlineThickness(2.0f);
     box.setOutlineColor(sf::Color(110, 110, 130));
+    bounds = box.getGlobalBounds();
 
     if (font)
     {
@@ -20,7 +21,7 @@ Button::Button(const sf::Font *font,
         centerText();
     }
 
-    updateColors();
+    applyColors(Look());
 }
 
 void Button::setLabel(const std::string &label)
@@ -32,7 +33,6 @@ void Button::setLabel(const std::string &label)
 void Button::setSelected(bool s)
 {
     selected = s;
-    updateColors();
 }
 
 void Button::centerText()
@@ -44,17 +44,17 @@ void Button::centerText()
     text.setPosition(pos.x + size.x / 2.0f, pos.y + size.y / 2.0f);
 }
 
-void Button::updateColors()
+void Button::applyColors(const Look &look)
 {
     // Base theme
     sf::Color fill(45, 45, 70);
     sf::Color outline(110, 110, 130);
 
-    if (selected)
+    if (look.selected)
         outline = sf::Color(255, 200, 0);
-    if (hovered)
+    if (look.hovered)
         fill = sf::Color(60, 60, 95);
-    if (pressed)
+    if (look.pressed)
         fill = sf::Color(35, 35, 55);
 
     box.setFillColor(fill);
@@ -63,7 +63,7 @@ void Button::updateColors()
 
 void Button::update(const sf::Vector2f &mousePos, bool mouseDown)
 {
-    const bool contains = box.getGlobalBounds().contains(mousePos);
+    const bool contains = bounds.contains(mousePos);
 
     // Track click on release
     if (!mouseDown && pressed && contains)
@@ -73,7 +73,11 @@ void Button::update(const sf::Vector2f &mousePos, bool mouseDown)
 
     hovered = contains;
     pressed = hovered && mouseDown;
-    updateColors();
+}
+
+void Button::update(const InputSnapshot &input)
+{
+    update(input.mouse(), input.isHeld(sf::Mouse::Left));
 }
 
 bool Button::consumeClick()
@@ -84,8 +88,9 @@ bool Button::consumeClick()
     return true;
 }
 
-void Button::render(sf::RenderTarget &target) const
+void Button::render(sf::RenderTarget &target, const Look &look)
 {
+    applyColors(look);
     target.draw(box);
     if (font)
         target.draw(text);
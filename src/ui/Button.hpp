@@ -3,9 +3,19 @@
 #include <SFML/Graphics.hpp>
 #include <string>
 
+#include "../core/InputManager.hpp"
+
 class Button
 {
 public:
+    // Visual state, captured on the simulation side and drawn by render()
+    struct Look
+    {
+        bool hovered = false;
+        bool pressed = false;
+        bool selected = false;
+    };
+
     Button() = default;
     Button(const sf::Font *font,
            const std::string &label,
@@ -17,14 +27,17 @@ public:
 
     // Feed mouse + click edge (pressed/released) info
     void update(const sf::Vector2f &mousePos, bool mouseDown);
+    void update(const InputSnapshot &input); // left button, press+release in one step included
     bool consumeClick(); // true once per click-release
 
-    void render(sf::RenderTarget &target) const;
+    Look getLook() const { return Look{hovered, pressed, selected}; }
+    void render(sf::RenderTarget &target, const Look &look);
 
     bool isHovered() const { return hovered; }
 
 private:
     const sf::Font *font = nullptr;
+    sf::FloatRect bounds; // hit box, read by update() (the shapes belong to render())
     sf::RectangleShape box;
     sf::Text text;
 
@@ -33,7 +46,7 @@ private:
     bool selected = false;
     bool clickReady = false;
 
-    void updateColors();
+    void applyColors(const Look &look);
     void centerText();
 };
 
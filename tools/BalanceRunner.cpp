@@ -0,0 +1,444 @@
+// CasseBriques_balance: plays thousands of headless games per Difficulty preset with
+// scripted bots (src/bots) across a thread pool, and reports win rate, game duration
+// and score distributions per mode and preset.
+//
+// Each game gets its own bot seed (different reaction time, accuracy...), so a run
+// samples a population of players; the same --seed gives the same report.
+// --reborn-bot search plays Reborn with the look-ahead RebornAutoplayer instead of
+// the scripted bot (much slower: a soak test / skill ceiling rather than a population).
+// --level plays a level file (.txt, or the first level of a .cblp pack) instead of the
+// built-in grids.
+//
+//   CasseBriques_balance [--games N] [--threads N] [--mode classic|reborn|both]
+//                        [--reborn-bot scripted|search] [--max-seconds S] [--seed N]
+//                        [--level FILE] [--format text|csv|json] [--out FILE]
+
+#include "bots/ClassicBot.hpp"
+#include "bots/RebornAutoplayer.hpp"
+#include "bots/RebornBot.hpp"
+#include "core/Difficulty.hpp"
+#include "core/JobSystem.hpp"
+#include "core/ThreadPool.hpp"
+#include "game/ClassicSimulation.hpp"
+#include "game_reborn/RebornSimulation.hpp"
+#include "level/Level.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr float STEP = 1.0f / 120.0f; // default Settings::simulationHz
+
+    const Difficulty PRESETS[] = {Difficulty::Easy, Difficulty::Normal, Difficulty::Hard};
+
+    struct Options
+    {
+        int games = 1000; // per mode and preset
+        unsigned threads = 0;
+        bool classic = true;
+        bool reborn = true;
+        bool rebornSearch = false; // RebornAutoplayer rather than RebornBot
+        float maxSeconds = 600.0f; // simulated time before a game counts as a timeout
+        std::uint32_t seed = 1;
+        Level level; // empty: built-in grids
+        std::string format = "text";
+        std::string outPath;
+    };
+
+    enum class Mode
+    {
+        Classic,
+        Reborn,
+    };
+
+    // One game to play: results are written to its own slot, no locking
+    struct Game
+    {
+        Mode mode = Mode::Classic;
+        Difficulty difficulty = Difficulty::Normal;
+        std::uint32_t seed = 0;
+
+        bool win = false;
+        bool timeout = false;
+        bool dangerLine = false; // Reborn: lost to the danger line rather than out of ammo
+        float seconds = 0.0f;    // simulated
+        int score = 0;
+        int resourceLeft = 0; // lives (Classic) / ammo (Reborn) at the end
+    };
+
+    struct Distribution
+    {
+        double mean = 0.0;
+        double min = 0.0;
+        double p10 = 0.0;
+        double p50 = 0.0;
+        double p90 = 0.0;
+        double max = 0.0;
+    };
+
+    struct Summary
+    {
+        Mode mode = Mode::Classic;
+        Difficulty difficulty = Difficulty::Normal;
+        int games = 0;
+        int wins = 0;
+        int timeouts = 0;
+        int dangerLineLosses = 0;
+        Distribution seconds;
+        Distribution score;
+        Distribution resourceLeft;
+    };
+
+    // Mixes the run seed and the game index into a bot seed
+    std::uint32_t gameSeed(std::uint32_t seed, std::size_t index)
+    {
+        std::uint64_t z = seed + 0x9E3779B97F4A7C15ull * (index + 1);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return static_cast<std::uint32_t>(z ^ (z >> 31));
+    }
+
+    void playClassic(Game &g, const Level &level, float maxSeconds)
+    {
+        ClassicSimulation sim(g.difficulty, level.grid());
+        ClassicBot bot(g.seed);
+        while (sim.getState() == ClassicSimulation::State::Playing && g.seconds < maxSeconds)
+        {
+            sim.step(STEP, bot.think(sim, STEP));
+            g.seconds += STEP;
+        }
+        g.win = sim.getState() == ClassicSimulation::State::Win;
+        g.timeout = sim.getState() == ClassicSimulation::State::Playing;
+        g.score = sim.getScore();
+        g.resourceLeft = sim.getLives();
+    }
+
+    template <typename Bot>
+    void playReborn(Game &g, Bot &bot, const Level &level, float maxSeconds)
+    {
+        RebornSimulation sim(g.difficulty, level.grid());
+        while (sim.getState() == RebornSimulation::State::Playing && g.seconds < maxSeconds)
+        {
+            sim.step(STEP, bot.think(sim, STEP));
+            g.seconds += STEP;
+        }
+        g.win = sim.getState() == RebornSimulation::State::Win;
+        g.timeout = sim.getState() == RebornSimulation::State::Playing;
+        g.dangerLine = sim.getState() == RebornSimulation::State::Lose &&
+                       sim.getLoseReason() == RebornSimulation::LoseReason::DangerLine;
+        g.score = sim.getScore();
+        g.resourceLeft = sim.getBudget() - sim.getUsed();
+    }
+
+    Distribution distribution(std::vector<double> values)
+    {
+        Distribution d;
+        if (values.empty())
+            return d;
+
+        std::sort(values.begin(), values.end());
+        const auto at = [&](double q)
+        { return values[static_cast<std::size_t>(q * (values.size() - 1) + 0.5)]; };
+
+        double sum = 0.0;
+        for (const double v : values)
+            sum += v;
+        d.mean = sum / values.size();
+        d.min = values.front();
+        d.p10 = at(0.10);
+        d.p50 = at(0.50);
+        d.p90 = at(0.90);
+        d.max = values.back();
+        return d;
+    }
+
+    Summary summarize(const std::vector<Game> &games, Mode mode, Difficulty difficulty)
+    {
+        Summary s;
+        s.mode = mode;
+        s.difficulty = difficulty;
+
+        std::vector<double> seconds, score, resourceLeft;
+        for (const Game &g : games)
+        {
+            if (g.mode != mode || g.difficulty != difficulty)
+                continue;
+            s.games++;
+            s.wins += g.win ? 1 : 0;
+            s.timeouts += g.timeout ? 1 : 0;
+            s.dangerLineLosses += g.dangerLine ? 1 : 0;
+            seconds.push_back(g.seconds);
+            score.push_back(g.score);
+            resourceLeft.push_back(g.resourceLeft);
+        }
+        s.seconds = distribution(std::move(seconds));
+        s.score = distribution(std::move(score));
+        s.resourceLeft = distribution(std::move(resourceLeft));
+        return s;
+    }
+
+    const char *modeName(Mode m)
+    {
+        return m == Mode::Classic ? "classic" : "reborn";
+    }
+
+    const char *resourceName(Mode m)
+    {
+        return m == Mode::Classic ? "lives" : "ammo";
+    }
+
+    const char *difficultyName(Difficulty d)
+    {
+        switch (d)
+        {
+        case Difficulty::Easy:
+            return "Easy";
+        case Difficulty::Hard:
+            return "Hard";
+        case Difficulty::Normal:
+        default:
+            return "Normal";
+        }
+    }
+
+    double winRate(const Summary &s)
+    {
+        return s.games > 0 ? 100.0 * s.wins / s.games : 0.0;
+    }
+
+    void writeDistributionText(std::ostream &os, const char *label, const Distribution &d)
+    {
+        os << "  " << std::left << std::setw(10) << label << std::right
+           << " mean " << std::setw(8) << d.mean << "   min " << std::setw(8) << d.min
+           << "   p10 " << std::setw(8) << d.p10 << "   p50 " << std::setw(8) << d.p50
+           << "   p90 " << std::setw(8) << d.p90 << "   max " << std::setw(8) << d.max << "\n";
+    }
+
+    void writeText(std::ostream &os, const std::vector<Summary> &summaries)
+    {
+        os << std::fixed << std::setprecision(1);
+        for (const Summary &s : summaries)
+        {
+            os << modeName(s.mode) << " " << difficultyName(s.difficulty) << ": " << s.games << " games, win rate "
+               << winRate(s) << "% (" << s.wins << " wins, " << s.timeouts << " timeouts";
+            if (s.mode == Mode::Reborn)
+                os << ", " << s.dangerLineLosses << " lost to the danger line";
+            os << ")\n";
+            writeDistributionText(os, "seconds", s.seconds);
+            writeDistributionText(os, "score", s.score);
+            writeDistributionText(os, resourceName(s.mode), s.resourceLeft);
+        }
+    }
+
+    void writeCsv(std::ostream &os, const std::vector<Summary> &summaries)
+    {
+        os << "mode,difficulty,games,wins,win_rate,timeouts,danger_line_losses";
+        for (const char *metric : {"seconds", "score", "left"})
+            for (const char *stat : {"mean", "min", "p10", "p50", "p90", "max"})
+                os << ',' << metric << '_' << stat;
+        os << '\n';
+
+        os << std::fixed << std::setprecision(3);
+        for (const Summary &s : summaries)
+        {
+            os << modeName(s.mode) << ',' << difficultyName(s.difficulty) << ',' << s.games << ',' << s.wins << ','
+               << winRate(s) << ',' << s.timeouts << ',' << s.dangerLineLosses;
+            for (const Distribution *d : {&s.seconds, &s.score, &s.resourceLeft})
+                os << ',' << d->mean << ',' << d->min << ',' << d->p10 << ',' << d->p50 << ',' << d->p90 << ',' << d->max;
+            os << '\n';
+        }
+    }
+
+    void writeDistributionJson(std::ostream &os, const char *name, const Distribution &d)
+    {
+        os << "\"" << name << "\": {\"mean\": " << d.mean << ", \"min\": " << d.min << ", \"p10\": " << d.p10
+           << ", \"p50\": " << d.p50 << ", \"p90\": " << d.p90 << ", \"max\": " << d.max << "}";
+    }
+
+    void writeJson(std::ostream &os, const std::vector<Summary> &summaries, const Options &opt, double wallSeconds)
+    {
+        os << std::fixed << std::setprecision(3);
+        os << "{\n  \"games_per_preset\": " << opt.games << ", \"seed\": " << opt.seed
+           << ", \"max_seconds\": " << opt.maxSeconds << ", \"wall_seconds\": " << wallSeconds << ",\n";
+        os << "  \"presets\": [\n";
+        for (std::size_t i = 0; i < summaries.size(); i++)
+        {
+            const Summary &s = summaries[i];
+            os << "    {\"mode\": \"" << modeName(s.mode) << "\", \"difficulty\": \"" << difficultyName(s.difficulty)
+               << "\", \"games\": " << s.games << ", \"wins\": " << s.wins << ", \"win_rate\": " << winRate(s)
+               << ", \"timeouts\": " << s.timeouts << ", \"danger_line_losses\": " << s.dangerLineLosses << ", ";
+            writeDistributionJson(os, "seconds", s.seconds);
+            os << ", ";
+            writeDistributionJson(os, "score", s.score);
+            os << ", ";
+            writeDistributionJson(os, resourceName(s.mode), s.resourceLeft);
+            os << "}" << (i + 1 < summaries.size() ? ",\n" : "\n");
+        }
+        os << "  ]\n}\n";
+    }
+
+    bool loadLevel(const std::string &path, Level &out, std::string &error)
+    {
+        if (path.size() < 5 || path.compare(path.size() - 5, 5, ".cblp") != 0)
+            return Level::loadText(path, out, error);
+
+        LevelPack pack;
+        if (!pack.open(path, error))
+            return false;
+        if (pack.size() == 0)
+        {
+            error = path + ": empty level pack";
+            return false;
+        }
+        out = Level(pack.level(0));
+        return true;
+    }
+
+    void printUsage()
+    {
+        std::cerr << "Usage: CasseBriques_balance [--games N] [--threads N] [--mode classic|reborn|both]\n"
+                     "                            [--reborn-bot scripted|search] [--max-seconds S] [--seed N]\n"
+                     "                            [--level FILE] [--format text|csv|json] [--out FILE]\n";
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opt;
+    std::string mode = "both";
+    std::string rebornBot = "scripted";
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--games" && hasValue)
+            opt.games = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--threads" && hasValue)
+            opt.threads = static_cast<unsigned>(std::max(0, std::atoi(argv[++i])));
+        else if (arg == "--mode" && hasValue)
+            mode = argv[++i];
+        else if (arg == "--reborn-bot" && hasValue)
+            rebornBot = argv[++i];
+        else if (arg == "--max-seconds" && hasValue)
+            opt.maxSeconds = std::max(1.0f, static_cast<float>(std::atof(argv[++i])));
+        else if (arg == "--seed" && hasValue)
+            opt.seed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--level" && hasValue)
+        {
+            std::string error;
+            if (!loadLevel(argv[++i], opt.level, error))
+            {
+                std::cerr << error << "\n";
+                return 1;
+            }
+        }
+        else if (arg == "--format" && hasValue)
+            opt.format = argv[++i];
+        else if (arg == "--out" && hasValue)
+            opt.outPath = argv[++i];
+        else
+        {
+            printUsage();
+            return (arg == "--help" || arg == "-h") ? 0 : 1;
+        }
+    }
+    opt.classic = mode == "classic" || mode == "both";
+    opt.reborn = mode == "reborn" || mode == "both";
+    opt.rebornSearch = rebornBot == "search";
+    if ((!opt.classic && !opt.reborn) || (rebornBot != "scripted" && !opt.rebornSearch) || (opt.format != "text" && opt.format != "csv" && opt.format != "json"))
+    {
+        printUsage();
+        return 1;
+    }
+
+    std::vector<Mode> modes;
+    if (opt.classic)
+        modes.push_back(Mode::Classic);
+    if (opt.reborn)
+        modes.push_back(Mode::Reborn);
+
+    std::vector<Game> games;
+    games.reserve(modes.size() * 3 * opt.games);
+    for (const Mode m : modes)
+    {
+        for (const Difficulty d : PRESETS)
+        {
+            for (int i = 0; i < opt.games; i++)
+            {
+                Game g;
+                g.mode = m;
+                g.difficulty = d;
+                // Same bot population for every preset: only the difficulty tables differ
+                g.seed = gameSeed(opt.seed, static_cast<std::size_t>(i));
+                games.push_back(g);
+            }
+        }
+    }
+
+    ThreadPool pool(opt.threads);
+    std::cerr << "Playing " << games.size() << " games on " << pool.size() << " threads...\n";
+
+    const auto t0 = Clock::now();
+    pool.parallelFor(games.size(), [&](std::size_t i, unsigned)
+                     {
+                         Game &g = games[i];
+                         if (g.mode == Mode::Classic)
+                         {
+                             playClassic(g, opt.level, opt.maxSeconds);
+                         }
+                         else if (opt.rebornSearch)
+                         {
+                             // Games are already spread over the pool: each search runs on its own thread
+                             JobSystem searchThread(1);
+                             RebornAutoplayer bot(searchThread, g.seed);
+                             playReborn(g, bot, opt.level, opt.maxSeconds);
+                         }
+                         else
+                         {
+                             RebornBot bot(g.seed);
+                             playReborn(g, bot, opt.level, opt.maxSeconds);
+                         } });
+    const double wallSeconds = std::chrono::duration<double>(Clock::now() - t0).count();
+
+    double simulatedSeconds = 0.0;
+    for (const Game &g : games)
+        simulatedSeconds += g.seconds;
+    std::cerr << std::fixed << std::setprecision(2) << "Done in " << wallSeconds << " s ("
+              << std::setprecision(0) << simulatedSeconds / std::max(wallSeconds, 1e-9) << "x real time)\n";
+
+    std::vector<Summary> summaries;
+    for (const Mode m : modes)
+        for (const Difficulty d : PRESETS)
+            summaries.push_back(summarize(games, m, d));
+
+    std::ofstream file;
+    if (!opt.outPath.empty())
+    {
+        file.open(opt.outPath);
+        if (!file)
+        {
+            std::cerr << "Cannot write " << opt.outPath << "\n";
+            return 1;
+        }
+    }
+    std::ostream &out = opt.outPath.empty() ? std::cout : file;
+
+    if (opt.format == "json")
+        writeJson(out, summaries, opt, wallSeconds);
+    else if (opt.format == "csv")
+        writeCsv(out, summaries);
+    else
+        writeText(out, summaries);
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+// CasseBriques_levelc: compiles text levels (levels/*.txt, see src/level/Level.hpp) into a
+// level pack (.cblp) that the game memory-maps at startup instead of parsing text.
+//
+// Levels are stored in the order given; directories contribute their .txt files sorted
+// by name. The pack is re-opened after writing and each grid compared with its source.
+//
+//   CasseBriques_levelc -o OUT.cblp PATH...
+//   CasseBriques_levelc --info PACK.cblp
+//
+// PATH is a .txt level or a directory (not searched recursively).
+
+#include "level/Level.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double microsecondsSince(Clock::time_point t0)
+    {
+        return std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+    }
+
+    std::vector<std::string> collectLevels(const std::vector<std::string> &paths)
+    {
+        std::vector<std::string> files;
+        for (const std::string &p : paths)
+        {
+            std::error_code ec;
+            if (!std::filesystem::is_directory(p, ec))
+            {
+                files.push_back(p);
+                continue;
+            }
+
+            std::vector<std::string> found;
+            for (const auto &entry : std::filesystem::directory_iterator(p, ec))
+            {
+                if (entry.is_regular_file() && entry.path().extension() == ".txt")
+                    found.push_back(entry.path().string());
+            }
+            std::sort(found.begin(), found.end());
+            files.insert(files.end(), found.begin(), found.end());
+        }
+        return files;
+    }
+
+    int printInfo(const std::string &path)
+    {
+        const auto t0 = Clock::now();
+        LevelPack pack;
+        std::string error;
+        if (!pack.open(path, error))
+        {
+            std::cerr << error << "\n";
+            return 1;
+        }
+        const double openUs = microsecondsSince(t0);
+
+        std::cout << path << ": " << pack.size() << " levels, opened in " << openUs << " us\n";
+        for (std::size_t i = 0; i < pack.size(); i++)
+        {
+            const LevelGrid g = pack.level(i);
+            std::cout << "  [" << i << "] " << g.rows << " x " << g.cols << "\n";
+        }
+        return 0;
+    }
+
+    void printUsage()
+    {
+        std::cerr << "Usage: CasseBriques_levelc -o OUT.cblp PATH...\n"
+                     "       CasseBriques_levelc --info PACK.cblp\n";
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::string outPath;
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "-o" && hasValue)
+            outPath = argv[++i];
+        else if (arg == "--info" && hasValue)
+            return printInfo(argv[++i]);
+        else if (arg == "--help" || arg == "-h")
+        {
+            printUsage();
+            return 0;
+        }
+        else if (!arg.empty() && arg[0] == '-')
+        {
+            printUsage();
+            return 1;
+        }
+        else
+            paths.push_back(arg);
+    }
+
+    const std::vector<std::string> files = collectLevels(paths);
+    if (outPath.empty() || files.empty())
+    {
+        printUsage();
+        return 1;
+    }
+
+    // Parse everything first: a bad level leaves the previous pack untouched
+    const auto t0 = Clock::now();
+    std::vector<Level> levels(files.size());
+    for (std::size_t i = 0; i < files.size(); i++)
+    {
+        std::string error;
+        if (!Level::loadText(files[i], levels[i], error))
+        {
+            std::cerr << error << "\n";
+            return 1;
+        }
+    }
+    const double parseUs = microsecondsSince(t0);
+
+    std::vector<LevelGrid> grids;
+    for (const Level &l : levels)
+        grids.push_back(l.grid());
+
+    std::string error;
+    if (!LevelPack::write(outPath, grids, error))
+    {
+        std::cerr << error << "\n";
+        return 1;
+    }
+
+    // Round trip: what the game will map must be what was parsed
+    const auto t1 = Clock::now();
+    LevelPack pack;
+    if (!pack.open(outPath, error))
+    {
+        std::cerr << error << "\n";
+        return 1;
+    }
+    const double openUs = microsecondsSince(t1);
+
+    for (std::size_t i = 0; i < levels.size(); i++)
+    {
+        const LevelGrid g = pack.level(i);
+        if (g.rows != levels[i].rows || g.cols != levels[i].cols ||
+            std::memcmp(g.hp, levels[i].hp.data(), levels[i].hp.size()) != 0)
+        {
+            std::cerr << outPath << ": level " << i << " (" << files[i] << ") does not read back\n";
+            return 1;
+        }
+    }
+
+    for (std::size_t i = 0; i < files.size(); i++)
+        std::cout << "  [" << i << "] " << files[i] << ": " << levels[i].rows << " x " << levels[i].cols << "\n";
+    std::cout << outPath << ": " << files.size() << " levels (text parse " << parseUs << " us, pack open "
+              << openUs << " us)\n";
+    return 0;
+}
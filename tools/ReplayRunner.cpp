@@ -0,0 +1,407 @@
+// CasseBriques_replay: re-simulates recorded games (.cbr, see src/replay/Replay.hpp)
+// without a window, as fast as the CPU allows.
+//
+// For each replay: ticks/s, time per phase (decode, simulate, hash), final score,
+// state and state hash, checked against the result stored at record time. Exits
+// with 1 if a replay cannot be read or does not reproduce its recorded result, so
+// a nightly run over the replay corpus is both a benchmark and a rules regression test.
+//
+//   CasseBriques_replay [--repeat N] [--format text|csv|json] [--out FILE]
+//                       [--trace FILE] PATH...
+//
+// PATH is a .cbr file or a directory (searched recursively for .cbr files).
+
+#include "core/Trace.hpp"
+#include "game/ClassicSimulation.hpp"
+#include "game_reborn/RebornSimulation.hpp"
+#include "replay/Replay.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Options
+    {
+        std::string format = "text";
+        std::string outPath;
+        std::string tracePath;
+        int repeat = 1; // simulate each replay N times, keep the fastest
+        std::vector<std::string> paths;
+    };
+
+    struct Outcome
+    {
+        std::string path;
+        std::string error; // not empty: the replay could not be read
+
+        ReplayHeader header;
+        ReplayResult expected;
+        std::size_t ticks = 0;
+
+        double decodeSeconds = 0.0;
+        double simulateSeconds = 0.0; // fastest of the repeats
+        double hashSeconds = 0.0;
+
+        int score = 0;
+        std::string state;
+        std::uint64_t stateHash = 0;
+        bool deterministic = true; // every repeat ended on the same hash
+
+        double ticksPerSecond() const { return simulateSeconds > 0.0 ? ticks / simulateSeconds : 0.0; }
+
+        // "ok", "MISMATCH", "NONDETERMINISTIC", "unchecked" (no recorded result) or "ERROR"
+        std::string verdict() const
+        {
+            if (!error.empty())
+                return "ERROR";
+            if (!deterministic)
+                return "NONDETERMINISTIC";
+            if (!expected.known)
+                return "unchecked";
+            return (expected.score == score && expected.stateHash == stateHash) ? "ok" : "MISMATCH";
+        }
+
+        bool failed() const
+        {
+            const std::string v = verdict();
+            return v != "ok" && v != "unchecked";
+        }
+    };
+
+    double secondsSince(Clock::time_point t0)
+    {
+        return std::chrono::duration<double>(Clock::now() - t0).count();
+    }
+
+    const char *modeName(const ReplayHeader &h)
+    {
+        if (h.mode == ReplayMode::Classic)
+            return "classic";
+        return h.endless ? "reborn_endless" : "reborn";
+    }
+
+    const char *difficultyName(Difficulty d)
+    {
+        switch (d)
+        {
+        case Difficulty::Easy:
+            return "Easy";
+        case Difficulty::Hard:
+            return "Hard";
+        case Difficulty::Normal:
+        default:
+            return "Normal";
+        }
+    }
+
+    template <typename Sim>
+    const char *stateName(typename Sim::State s)
+    {
+        switch (s)
+        {
+        case Sim::State::Win:
+            return "win";
+        case Sim::State::Lose:
+            return "lose";
+        case Sim::State::Playing:
+        default:
+            return "playing";
+        }
+    }
+
+    // Simulation described by a replay header
+    template <typename Sim>
+    Sim makeSimulation(const ReplayHeader &header);
+
+    template <>
+    ClassicSimulation makeSimulation<ClassicSimulation>(const ReplayHeader &header)
+    {
+        return ClassicSimulation(header.difficulty, header.level.grid());
+    }
+
+    template <>
+    RebornSimulation makeSimulation<RebornSimulation>(const ReplayHeader &header)
+    {
+        const RebornSimulation::Mode mode = header.endless ? RebornSimulation::Mode::Endless : RebornSimulation::Mode::Standard;
+        return RebornSimulation(header.difficulty, header.level.grid(), mode, header.seed);
+    }
+
+    /**
+     * Steps a fresh simulation through every recorded tick (with the recorded step size),
+     * then hashes the final state.
+     */
+    template <typename Sim, typename InputAt>
+    void simulate(const Replay &replay, const Options &opt, Outcome &out, InputAt inputAt)
+    {
+        const float dt = replay.header.stepSeconds();
+
+        for (int run = 0; run < opt.repeat; run++)
+        {
+            TRACE_SCOPE("ReplayRunner::simulate");
+
+            Sim sim = makeSimulation<Sim>(replay.header);
+            const auto t0 = Clock::now();
+            for (std::size_t tick = 0; tick < replay.size(); tick++)
+                sim.step(dt, inputAt(replay, tick));
+            const double seconds = secondsSince(t0);
+
+            const auto h0 = Clock::now();
+            const std::uint64_t hash = sim.stateHash();
+            const double hashSeconds = secondsSince(h0);
+
+            if (run == 0 || seconds < out.simulateSeconds)
+                out.simulateSeconds = seconds;
+            if (run == 0 || hashSeconds < out.hashSeconds)
+                out.hashSeconds = hashSeconds;
+
+            if (run > 0 && hash != out.stateHash)
+                out.deterministic = false;
+            out.stateHash = hash;
+            out.score = sim.getScore();
+            out.state = stateName<Sim>(sim.getState());
+        }
+    }
+
+    Outcome runReplay(const std::string &path, const Options &opt)
+    {
+        TRACE_SCOPE("ReplayRunner::runReplay");
+
+        Outcome out;
+        out.path = path;
+
+        Replay replay;
+        const auto t0 = Clock::now();
+        if (!Replay::loadFromFile(path, replay, out.error))
+            return out;
+        out.decodeSeconds = secondsSince(t0);
+
+        out.header = replay.header;
+        out.expected = replay.result;
+        out.ticks = replay.size();
+
+        if (replay.header.mode == ReplayMode::Classic)
+            simulate<ClassicSimulation>(replay, opt, out, [](const Replay &r, std::size_t t)
+                                        { return r.classicInput(t); });
+        else
+            simulate<RebornSimulation>(replay, opt, out, [](const Replay &r, std::size_t t)
+                                       { return r.rebornInput(t); });
+        return out;
+    }
+
+    // Files as given, directories searched recursively; sorted so runs are comparable
+    std::vector<std::string> collectReplays(const std::vector<std::string> &paths)
+    {
+        std::vector<std::string> files;
+        for (const std::string &p : paths)
+        {
+            std::error_code ec;
+            if (!std::filesystem::is_directory(p, ec))
+            {
+                files.push_back(p);
+                continue;
+            }
+
+            std::vector<std::string> found;
+            for (const auto &entry : std::filesystem::recursive_directory_iterator(p, ec))
+            {
+                if (entry.is_regular_file() && entry.path().extension() == ".cbr")
+                    found.push_back(entry.path().string());
+            }
+            std::sort(found.begin(), found.end());
+            files.insert(files.end(), found.begin(), found.end());
+        }
+        return files;
+    }
+
+    std::string hex(std::uint64_t v)
+    {
+        std::ostringstream ss;
+        ss << std::hex << std::setw(16) << std::setfill('0') << v;
+        return ss.str();
+    }
+
+    std::string jsonEscape(const std::string &s)
+    {
+        std::string out;
+        for (const char c : s)
+        {
+            if (c == '"' || c == '\\')
+                out += '\\';
+            out += c;
+        }
+        return out;
+    }
+
+    void writeText(std::ostream &os, const std::vector<Outcome> &outcomes)
+    {
+        std::size_t totalTicks = 0;
+        double totalSeconds = 0.0;
+        int failures = 0;
+
+        for (const Outcome &o : outcomes)
+        {
+            os << o.path << "\n";
+            if (!o.error.empty())
+            {
+                os << "  ERROR: " << o.error << "\n";
+                failures++;
+                continue;
+            }
+
+            os << std::fixed << std::setprecision(3)
+               << "  " << modeName(o.header) << " " << difficultyName(o.header.difficulty)
+               << " @" << o.header.simulationHz << " Hz, " << o.ticks << " ticks\n"
+               << "  " << std::setprecision(0) << o.ticksPerSecond() << " ticks/s" << std::setprecision(3)
+               << "   decode " << o.decodeSeconds * 1e3 << " ms"
+               << "   simulate " << o.simulateSeconds * 1e3 << " ms"
+               << "   hash " << o.hashSeconds * 1e3 << " ms\n"
+               << "  score " << o.score << "   state " << o.state << "   hash " << hex(o.stateHash)
+               << "   " << o.verdict() << "\n";
+
+            totalTicks += o.ticks;
+            totalSeconds += o.simulateSeconds;
+            failures += o.failed() ? 1 : 0;
+        }
+
+        os << std::setprecision(0) << outcomes.size() << " replays, " << totalTicks << " ticks, "
+           << (totalSeconds > 0.0 ? totalTicks / totalSeconds : 0.0) << " ticks/s overall, "
+           << failures << " failed\n";
+    }
+
+    void writeCsv(std::ostream &os, const std::vector<Outcome> &outcomes)
+    {
+        os << "replay,mode,difficulty,hz,ticks,ticks_per_s,decode_ms,simulate_ms,hash_ms,score,state,state_hash,verdict\n";
+        os << std::fixed;
+        for (const Outcome &o : outcomes)
+        {
+            os << o.path << ',' << modeName(o.header) << ',' << difficultyName(o.header.difficulty) << ','
+               << o.header.simulationHz << ',' << o.ticks << ',' << std::setprecision(0) << o.ticksPerSecond() << ','
+               << std::setprecision(6) << o.decodeSeconds * 1e3 << ',' << o.simulateSeconds * 1e3 << ','
+               << o.hashSeconds * 1e3 << ',' << o.score << ',' << o.state << ',' << hex(o.stateHash) << ','
+               << o.verdict() << '\n';
+        }
+    }
+
+    void writeJson(std::ostream &os, const std::vector<Outcome> &outcomes, const Options &opt)
+    {
+        os << std::fixed << std::setprecision(6);
+        os << "{\n  \"repeat\": " << opt.repeat << ",\n  \"replays\": [\n";
+        for (std::size_t i = 0; i < outcomes.size(); i++)
+        {
+            const Outcome &o = outcomes[i];
+            os << "    {\"replay\": \"" << jsonEscape(o.path) << "\", \"verdict\": \"" << o.verdict() << "\"";
+            if (!o.error.empty())
+            {
+                os << ", \"error\": \"" << jsonEscape(o.error) << "\"}";
+            }
+            else
+            {
+                os << ", \"mode\": \"" << modeName(o.header) << "\""
+                   << ", \"difficulty\": \"" << difficultyName(o.header.difficulty) << "\""
+                   << ", \"hz\": " << o.header.simulationHz << ", \"ticks\": " << o.ticks
+                   << ", \"ticks_per_s\": " << o.ticksPerSecond()
+                   << ", \"phases_ms\": {\"decode\": " << o.decodeSeconds * 1e3
+                   << ", \"simulate\": " << o.simulateSeconds * 1e3 << ", \"hash\": " << o.hashSeconds * 1e3 << "}"
+                   << ", \"score\": " << o.score << ", \"state\": \"" << o.state << "\""
+                   << ", \"state_hash\": \"" << hex(o.stateHash) << "\"";
+                if (o.expected.known)
+                    os << ", \"expected_score\": " << o.expected.score
+                       << ", \"expected_hash\": \"" << hex(o.expected.stateHash) << "\"";
+                os << "}";
+            }
+            os << (i + 1 < outcomes.size() ? ",\n" : "\n");
+        }
+        os << "  ]\n}\n";
+    }
+
+    void printUsage()
+    {
+        std::cerr << "Usage: CasseBriques_replay [--repeat N] [--format text|csv|json] [--out FILE]\n"
+                     "                           [--trace FILE] PATH...\n";
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    TRACE_THREAD_NAME("main");
+
+    Options opt;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--repeat" && hasValue)
+            opt.repeat = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--format" && hasValue)
+            opt.format = argv[++i];
+        else if (arg == "--out" && hasValue)
+            opt.outPath = argv[++i];
+        else if (arg == "--trace" && hasValue)
+            opt.tracePath = argv[++i];
+        else if (arg == "--help" || arg == "-h")
+        {
+            printUsage();
+            return 0;
+        }
+        else if (!arg.empty() && arg[0] == '-')
+        {
+            printUsage();
+            return 1;
+        }
+        else
+            opt.paths.push_back(arg);
+    }
+    if (opt.paths.empty() || (opt.format != "text" && opt.format != "csv" && opt.format != "json"))
+    {
+        printUsage();
+        return 1;
+    }
+
+    std::vector<Outcome> outcomes;
+    for (const std::string &path : collectReplays(opt.paths))
+        outcomes.push_back(runReplay(path, opt));
+
+    std::ofstream file;
+    if (!opt.outPath.empty())
+    {
+        file.open(opt.outPath);
+        if (!file)
+        {
+            std::cerr << "Cannot write " << opt.outPath << "\n";
+            return 1;
+        }
+    }
+    std::ostream &out = opt.outPath.empty() ? std::cout : file;
+
+    if (opt.format == "json")
+        writeJson(out, outcomes, opt);
+    else if (opt.format == "csv")
+        writeCsv(out, outcomes);
+    else
+        writeText(out, outcomes);
+
+    // Step-level breakdown (moveBall, moveProjectiles...) needs a CASSEBRIQUES_TRACING build
+    if (!opt.tracePath.empty())
+    {
+        if (!Trace::isEnabled())
+            std::cerr << "--trace ignored: built without CASSEBRIQUES_TRACING\n";
+        else if (!Trace::writeChromeJson(opt.tracePath))
+            std::cerr << "Cannot write " << opt.tracePath << "\n";
+    }
+
+    const bool anyFailed = std::any_of(outcomes.begin(), outcomes.end(), [](const Outcome &o)
+                                       { return o.failed(); });
+    return anyFailed ? 1 : 0;
+}